@@ -0,0 +1,8 @@
+// The one translation unit that instantiates the extern dispatch table.
+#include "kernel.hpp"
+
+POET_DEFINE_DISPATCH(compile_bench::tile_kernel,
+  float(const float *, const float *),
+  compile_bench::Ms,
+  compile_bench::Ns,
+  compile_bench::Ks);
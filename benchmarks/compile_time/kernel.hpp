@@ -0,0 +1,30 @@
+#pragma once
+// Shared kernel for the extern-dispatch compile-time benchmark (scripts/bench_compile_time.sh).
+// A 16 x 8 x 4 product: 512 thunks, each inlining a small loop nest.
+#include <poet/core/dispatch.hpp>
+
+namespace compile_bench {
+
+using Ms = poet::inclusive_range<1, 16>;
+using Ns = poet::inclusive_range<1, 8>;
+using Ks = poet::pow2_range<1, 8>;
+
+struct tile_kernel {
+    template<int M, int N, int K> float operator()(const float *a, const float *b) const {
+        float acc = 0.0F;
+        for (int i = 0; i < M; ++i) {
+            for (int j = 0; j < N; ++j) { acc += a[i] * b[j] * static_cast<float>(K); }
+        }
+        return acc;
+    }
+};
+
+}// namespace compile_bench
+
+#if POET_COMPILE_BENCH_EXTERN
+POET_DECLARE_DISPATCH(compile_bench::tile_kernel,
+  float(const float *, const float *),
+  compile_bench::Ms,
+  compile_bench::Ns,
+  compile_bench::Ks);
+#endif
@@ -0,0 +1,20 @@
+// One of many translation units calling the same dispatch. The script compiles this file
+// POET_COMPILE_BENCH_UNITS times, with and without POET_COMPILE_BENCH_EXTERN.
+#include "kernel.hpp"
+
+#ifndef POET_COMPILE_BENCH_UNIT
+#define POET_COMPILE_BENCH_UNIT 0
+#endif
+
+#define POET_COMPILE_BENCH_CAT2(a, b) a##b
+#define POET_COMPILE_BENCH_CAT(a, b) POET_COMPILE_BENCH_CAT2(a, b)
+
+auto POET_COMPILE_BENCH_CAT(run_tile_, POET_COMPILE_BENCH_UNIT)(int m, int n, int k, const float *a, const float *b)
+  -> float {
+    return poet::dispatch(compile_bench::tile_kernel{},
+      poet::dispatch_param<compile_bench::Ms>{ m },
+      poet::dispatch_param<compile_bench::Ns>{ n },
+      poet::dispatch_param<compile_bench::Ks>{ k },
+      a,
+      b);
+}
@@ -23,6 +23,12 @@ volatile int runtime_noise = 1;
 // 1D ranges
 using range_1d_contig = poet::inclusive_range<1, 8>;
 using range_1d_noncontig = std::integer_sequence<int, 1, 10, 20, 30, 40, 50, 60, 70>;
+using range_1d_pow2 = poet::pow2_range<1, 1024>;
+using range_1d_sparse_wide = std::integer_sequence<int, 1, 100, 1000, 2500, 7000, 10000, 40000, 99999>;
+
+template<int... Is> auto squares_times_1000(std::integer_sequence<int, Is...>)
+  -> std::integer_sequence<int, (Is * Is * 1000)...>;
+using range_1d_sparse_large = decltype(squares_times_1000(std::make_integer_sequence<int, 64>{}));
 
 // 2D ranges
 using range_2d_contig = poet::inclusive_range<1, 8>;
@@ -75,6 +81,63 @@ int main(int argc, char **argv) {
         }
     })->MinTime(0.1);
 
+    benchmark::RegisterBenchmark("Dispatch/1D_pow2_hit", [](benchmark::State &state) {
+        for (auto _ : state) {
+            auto v = 1 << (next_noise() & 7);
+            benchmark::DoNotOptimize(v);
+            benchmark::DoNotOptimize(poet::dispatch(simple_kernel{}, poet::dispatch_param<range_1d_pow2>{ v }, 2));
+        }
+    })->MinTime(0.1);
+
+    benchmark::RegisterBenchmark("Dispatch/1D_pow2_miss", [](benchmark::State &state) {
+        for (auto _ : state) {
+            auto v = 3 + ((next_noise() & 7) << 1);
+            benchmark::DoNotOptimize(v);
+            benchmark::DoNotOptimize(poet::dispatch(simple_kernel{}, poet::dispatch_param<range_1d_pow2>{ v }, 2));
+        }
+    })->MinTime(0.1);
+
+    // Sparse sets too wide for a direct table: small ones use a compare scan, large ones
+    // an Eytzinger-layout search.
+    benchmark::RegisterBenchmark("Dispatch/1D_sparse_wide_hit", [](benchmark::State &state) {
+        for (auto _ : state) {
+            constexpr std::array<int, 8> vals{ 1, 100, 1000, 2500, 7000, 10000, 40000, 99999 };
+            auto v = vals[static_cast<std::size_t>(next_noise() & 7)];
+            benchmark::DoNotOptimize(v);
+            benchmark::DoNotOptimize(
+              poet::dispatch(simple_kernel{}, poet::dispatch_param<range_1d_sparse_wide>{ v }, 2));
+        }
+    })->MinTime(0.1);
+
+    benchmark::RegisterBenchmark("Dispatch/1D_sparse_wide_miss", [](benchmark::State &state) {
+        for (auto _ : state) {
+            auto v = 5 + ((next_noise() & 7) * 1237);
+            benchmark::DoNotOptimize(v);
+            benchmark::DoNotOptimize(
+              poet::dispatch(simple_kernel{}, poet::dispatch_param<range_1d_sparse_wide>{ v }, 2));
+        }
+    })->MinTime(0.1);
+
+    benchmark::RegisterBenchmark("Dispatch/1D_sparse_large_hit", [](benchmark::State &state) {
+        for (auto _ : state) {
+            const int i = next_noise() & 63;
+            auto v = i * i * 1000;
+            benchmark::DoNotOptimize(v);
+            benchmark::DoNotOptimize(
+              poet::dispatch(simple_kernel{}, poet::dispatch_param<range_1d_sparse_large>{ v }, 2));
+        }
+    })->MinTime(0.1);
+
+    benchmark::RegisterBenchmark("Dispatch/1D_sparse_large_miss", [](benchmark::State &state) {
+        for (auto _ : state) {
+            const int i = next_noise() & 63;
+            auto v = (i * i * 1000) + 1;
+            benchmark::DoNotOptimize(v);
+            benchmark::DoNotOptimize(
+              poet::dispatch(simple_kernel{}, poet::dispatch_param<range_1d_sparse_large>{ v }, 2));
+        }
+    })->MinTime(0.1);
+
     // ── 2D Dispatch ─────────────────────────────────────────────────────
     benchmark::RegisterBenchmark("Dispatch/2D_contiguous_hit", [](benchmark::State &state) {
         for (auto _ : state) {
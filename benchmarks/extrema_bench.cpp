@@ -0,0 +1,86 @@
+/// \file extrema_bench.cpp
+/// \brief argmax / minmax with per-lane candidates vs the standard algorithms.
+///
+/// `std::max_element` is one serial compare-and-select chain. `poet::argmax<U>`
+/// keeps U independent chains and merges them at the end; the threaded rows
+/// split the same input across worker threads.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <poet/poet.hpp>
+
+namespace {
+
+auto make_data(std::size_t n) -> std::vector<float> {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> dist(-1.0F, 1.0F);
+    std::vector<float> v(n);
+    for (auto &x : v) x = dist(rng);
+    return v;
+}
+
+void BM_StdMaxElement(benchmark::State &state) {
+    const auto v = make_data(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto idx = std::distance(v.begin(), std::max_element(v.begin(), v.end()));
+        benchmark::DoNotOptimize(idx);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<std::size_t U> void BM_PoetArgmax(benchmark::State &state) {
+    const auto v = make_data(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto idx = poet::argmax<U>(v.data(), v.size());
+        benchmark::DoNotOptimize(idx);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_PoetArgmaxThreads(benchmark::State &state) {
+    const auto v = make_data(static_cast<std::size_t>(state.range(0)));
+    const std::size_t threads = std::max(1U, std::thread::hardware_concurrency());
+    for (auto _ : state) {
+        auto idx = poet::argmax<8>(v.data(), v.size(), threads);
+        benchmark::DoNotOptimize(idx);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_StdMinmaxElement(benchmark::State &state) {
+    const auto v = make_data(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto extremes = std::minmax_element(v.begin(), v.end());
+        benchmark::DoNotOptimize(extremes);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_PoetMinmax(benchmark::State &state) {
+    const auto v = make_data(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto extremes = poet::minmax<8>(v.data(), v.size());
+        benchmark::DoNotOptimize(extremes);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}// namespace
+
+BENCHMARK(BM_StdMaxElement)->Arg(4096)->Arg(1 << 22);
+BENCHMARK_TEMPLATE(BM_PoetArgmax, 1)->Arg(4096)->Arg(1 << 22);
+BENCHMARK_TEMPLATE(BM_PoetArgmax, 4)->Arg(4096)->Arg(1 << 22);
+BENCHMARK_TEMPLATE(BM_PoetArgmax, 8)->Arg(4096)->Arg(1 << 22);
+BENCHMARK(BM_PoetArgmaxThreads)->Arg(1 << 22)->UseRealTime();
+BENCHMARK(BM_StdMinmaxElement)->Arg(4096)->Arg(1 << 22);
+BENCHMARK(BM_PoetMinmax)->Arg(4096)->Arg(1 << 22);
+
+BENCHMARK_MAIN();
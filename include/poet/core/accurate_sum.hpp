@@ -0,0 +1,173 @@
+#pragma once
+
+/// \file accurate_sum.hpp
+/// \brief Compensated (Neumaier) sums and dot products with per-lane accumulators.
+///
+/// A Kahan or Neumaier sum feeds every element through one serial chain of
+/// dependent additions, so it runs several times slower than a naive loop.
+/// `accurate_sum<Unroll>` gives each `dynamic_for` lane its own running sum and
+/// compensation term, which keeps `Unroll` chains in flight, and merges the
+/// lanes with one more compensated pass at the end. `accurate_dot` also
+/// recovers the rounding error of each product exactly before adding it.
+///
+/// The compensation relies on IEEE rounding being preserved: building with
+/// `-ffast-math` (or `-fassociative-math`) lets the compiler cancel it away.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include <poet/core/dynamic_for.hpp>
+#include <poet/core/macros.hpp>
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+#include <span>
+#endif
+
+namespace poet {
+
+namespace detail {
+
+    // Adds `x` to `sum` and accumulates the rounding error of that addition in
+    // `comp`. Unlike Kahan, Neumaier's update stays exact when |x| > |sum|. The
+    // select compiles to a blend, so there is no data-dependent branch.
+    template<typename T> POET_FORCEINLINE void neumaier_add(T &sum, T &comp, T x) noexcept {
+        const T t = sum + x;
+        const T lost_small = std::abs(sum) >= std::abs(x) ? (sum - t) + x : (x - t) + sum;
+        comp += lost_small;
+        sum = t;
+    }
+
+#if defined(FP_FAST_FMAF)
+    inline constexpr bool fast_fma_float = true;
+#else
+    inline constexpr bool fast_fma_float = false;
+#endif
+#if defined(FP_FAST_FMA)
+    inline constexpr bool fast_fma_double = true;
+#else
+    inline constexpr bool fast_fma_double = false;
+#endif
+#if defined(FP_FAST_FMAL)
+    inline constexpr bool fast_fma_long_double = true;
+#else
+    inline constexpr bool fast_fma_long_double = false;
+#endif
+
+    template<typename T>
+    inline constexpr bool has_fast_fma_v = std::is_same_v<T, float> ? fast_fma_float
+                                           : std::is_same_v<T, double>
+                                             ? fast_fma_double
+                                             : std::is_same_v<T, long double> && fast_fma_long_double;
+
+    // Veltkamp's splitting constant 2^ceil(digits / 2) + 1.
+    template<typename T> constexpr auto veltkamp_factor() noexcept -> T {
+        T factor = 1;
+        for (int i = 0; i < (std::numeric_limits<T>::digits + 1) / 2; ++i) { factor *= 2; }
+        return factor + 1;
+    }
+
+    // Returns the rounding error `e` of `p = a * b`, so that `a * b == p + e` exactly.
+    // A hardware FMA gives it in one instruction; otherwise Dekker's product
+    // splits both factors into halves whose partial products are exact.
+    template<typename T> POET_FORCEINLINE auto product_error(T a, T b, T p) noexcept -> T {
+        if constexpr (has_fast_fma_v<T>) {
+            return std::fma(a, b, -p);
+        } else {
+            constexpr T factor = veltkamp_factor<T>();
+            const T ca = factor * a;
+            const T a_hi = ca - (ca - a);
+            const T a_lo = a - a_hi;
+            const T cb = factor * b;
+            const T b_hi = cb - (cb - b);
+            const T b_lo = b - b_hi;
+            return a_lo * b_lo - (((p - a_hi * b_hi) - a_lo * b_hi) - a_hi * b_lo);
+        }
+    }
+
+    // Per-lane running sums and compensations, kept as two arrays so that the
+    // lanes of one unrolled block sit next to each other and can share a vector.
+    template<typename T, std::size_t Lanes> struct neumaier_lanes {
+        std::array<T, Lanes> sum{};
+        std::array<T, Lanes> comp{};
+
+        // Adds the lane sums with one more compensated pass; the lane
+        // compensations are small and are added plainly. Once an input or an
+        // intermediate sum is infinite, the compensation holds `inf - inf`, so
+        // the plain total (±inf or NaN, as a naive sum would give) is returned.
+        [[nodiscard]] auto merge() const noexcept -> T {
+            T total{};
+            T total_comp{};
+            T lane_comp{};
+            for (std::size_t lane = 0; lane < Lanes; ++lane) {
+                neumaier_add(total, total_comp, sum[lane]);
+                lane_comp += comp[lane];
+            }
+            if (!std::isfinite(total)) { return total; }
+            return total + (total_comp + lane_comp);
+        }
+    };
+
+}// namespace detail
+
+/// \brief Sum of `data[0..count)` with Neumaier compensation in each of `Unroll` lanes.
+///
+/// The result is typically as accurate as summing in twice the precision of `T`
+/// and then rounding, while running close to the speed of a plain lane-split sum.
+/// Lanes see interleaved elements, so results can differ between `Unroll` values
+/// in the last bit.
+template<std::size_t Unroll = 4, typename T>
+[[nodiscard]] auto accurate_sum(const T *data, std::size_t count) noexcept -> T {
+    static_assert(std::is_floating_point_v<T>, "accurate_sum requires a floating-point element type");
+    static_assert(Unroll > 0, "accurate_sum requires Unroll > 0");
+    detail::neumaier_lanes<T, Unroll> lanes;
+    dynamic_for<Unroll>(
+      std::size_t{ 0 }, count, [&lanes, data](auto lane, std::size_t i) POET_ALWAYS_INLINE_LAMBDA {
+          detail::neumaier_add(lanes.sum[lane], lanes.comp[lane], data[i]);
+      });
+    return lanes.merge();
+}
+
+/// \brief Dot product of `a[0..count)` and `b[0..count)` with compensated products and sums.
+///
+/// Each product's rounding error is recovered exactly, with `std::fma` when the
+/// target has a fast FMA for `T` and with Dekker's splitting otherwise, and is
+/// folded into the lane's compensation. Dekker's splitting overflows for factors
+/// near the top of `T`'s range (above about 2^996 for `double`).
+template<std::size_t Unroll = 4, typename T>
+[[nodiscard]] auto accurate_dot(const T *a, const T *b, std::size_t count) noexcept -> T {
+    static_assert(std::is_floating_point_v<T>, "accurate_dot requires a floating-point element type");
+    static_assert(Unroll > 0, "accurate_dot requires Unroll > 0");
+    detail::neumaier_lanes<T, Unroll> lanes;
+    dynamic_for<Unroll>(
+      std::size_t{ 0 }, count, [&lanes, a, b](auto lane, std::size_t i) POET_ALWAYS_INLINE_LAMBDA {
+          const T p = a[i] * b[i];
+          lanes.comp[lane] += detail::product_error(a[i], b[i], p);
+          detail::neumaier_add(lanes.sum[lane], lanes.comp[lane], p);
+      });
+    return lanes.merge();
+}
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+
+/// \brief `accurate_sum` over a span.
+template<std::size_t Unroll = 4, typename T, std::size_t Extent>
+[[nodiscard]] auto accurate_sum(std::span<T, Extent> values) noexcept -> std::remove_cv_t<T> {
+    return accurate_sum<Unroll>(static_cast<const std::remove_cv_t<T> *>(values.data()), values.size());
+}
+
+/// \brief `accurate_dot` over two spans; reads the length of the shorter one.
+template<std::size_t Unroll = 4, typename T, std::size_t ExtentA, typename U, std::size_t ExtentB>
+[[nodiscard]] auto accurate_dot(std::span<T, ExtentA> a, std::span<U, ExtentB> b) noexcept -> std::remove_cv_t<T> {
+    static_assert(std::is_same_v<std::remove_cv_t<T>, std::remove_cv_t<U>>, "accurate_dot spans must share a type");
+    using value_t = std::remove_cv_t<T>;
+    return accurate_dot<Unroll>(
+      static_cast<const value_t *>(a.data()), static_cast<const value_t *>(b.data()), std::min(a.size(), b.size()));
+}
+
+#endif
+
+}// namespace poet
@@ -0,0 +1,162 @@
+#pragma once
+
+/// \file compact.hpp
+/// \brief Stream compaction (`copy_if`) with block-local output offsets.
+///
+/// A `copy_if` loop branches on every predicate and then advances one shared
+/// output cursor. `compact<Unroll>` evaluates the predicates of a whole block of
+/// `Unroll` elements first and turns the flags into per-lane offsets with a
+/// short prefix sum. It then stores every element of the block at its offset
+/// without branching. Rejected elements are stored too and are overwritten by
+/// the next survivor, so the cursor advances once per block instead of once per
+/// element.
+///
+/// With `threads > 1`, large inputs take two passes over contiguous chunks. The
+/// first counts each chunk's survivors, and the second compacts every chunk to
+/// its offset in the output.
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <poet/core/dynamic_for.hpp>
+#include <poet/core/macros.hpp>
+#include <poet/core/parallel_chunks.hpp>
+#include <poet/core/static_for.hpp>
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+#include <span>
+#endif
+
+namespace poet {
+
+namespace detail {
+
+    // Compacts `in[0..count)` into `out` and returns the number of survivors.
+    // Every element is stored at the cursor, and the cursor only moves past
+    // survivors, so the store for element `i` never lands beyond `out[i]`. The
+    // block is loaded before any store, so `out == in` is safe.
+    template<std::size_t Unroll, typename T, typename Pred>
+    auto compact_serial(const T *in, std::size_t count, T *out, Pred &pred) -> std::size_t {
+        constexpr auto lanes = static_cast<std::ptrdiff_t>(Unroll);
+        std::size_t pos = 0;
+        std::size_t i = 0;
+        for (; count - i >= Unroll; i += Unroll) {
+            std::array<T, Unroll> block;
+            std::array<std::size_t, Unroll + 1> offset;
+            offset[0] = 0;
+            static_for<lanes>([&](auto lane) POET_ALWAYS_INLINE_LAMBDA {
+                constexpr auto L = static_cast<std::size_t>(decltype(lane)::value);
+                block[L] = in[i + L];
+                offset[L + 1] = offset[L] + (static_cast<bool>(pred(std::as_const(block[L]))) ? 1 : 0);
+            });
+            static_for<lanes>([&](auto lane) POET_ALWAYS_INLINE_LAMBDA {
+                constexpr auto L = static_cast<std::size_t>(decltype(lane)::value);
+                out[pos + offset[L]] = block[L];
+            });
+            pos += offset[Unroll];
+        }
+        for (; i < count; ++i) {
+            const T value = in[i];
+            const bool keep = static_cast<bool>(pred(value));
+            out[pos] = value;
+            pos += keep ? 1 : 0;
+        }
+        return pos;
+    }
+
+    // Returns the survivor count of `in[0..count)` and, through `last`, one past
+    // the last survivor's position (0 when there is none).
+    template<std::size_t Unroll, typename T, typename Pred>
+    auto count_survivors(const T *in, std::size_t count, Pred &pred, std::size_t &last) -> std::size_t {
+        std::array<std::size_t, Unroll> kept{};
+        std::array<std::size_t, Unroll> end{};
+        dynamic_for<Unroll>(
+          std::size_t{ 0 }, count, [&kept, &end, &pred, in](auto lane, std::size_t i) POET_ALWAYS_INLINE_LAMBDA {
+              const bool keep = static_cast<bool>(pred(in[i]));
+              kept[lane] += keep ? 1 : 0;
+              end[lane] = keep ? i + 1 : end[lane];
+          });
+        std::size_t total = 0;
+        last = 0;
+        for (std::size_t lane = 0; lane < Unroll; ++lane) {
+            total += kept[lane];
+            last = end[lane] > last ? end[lane] : last;
+        }
+        return total;
+    }
+
+    template<std::size_t Unroll, typename T, typename Pred>
+    auto compact_impl(const T *in, std::size_t count, T *out, Pred &pred, std::size_t threads) -> std::size_t {
+        static_assert(
+          std::is_trivially_copyable_v<T>, "compact stores rejected elements, so T must be trivially copyable");
+        static_assert(std::is_invocable_v<Pred &, const T &>, "compact predicate must accept a const element");
+        static_assert(Unroll > 0, "compact requires Unroll > 0");
+
+        // Chunks write to other chunks' input positions, so overlapping ranges stay serial.
+        const bool overlaps = std::less<const T *>{}(out, in + count) && std::less<const T *>{}(in, out + count);
+        const std::size_t chunks = overlaps ? 1 : parallel_chunk_count(count, threads);
+        if (chunks == 1) { return compact_serial<Unroll>(in, count, out, pred); }
+
+        // Pass 1: survivors per chunk, and where each chunk's last survivor is.
+        std::vector<std::size_t> kept(chunks);
+        std::vector<std::size_t> last(chunks);
+        auto count_chunk = [&kept, &last, &pred, in](std::size_t chunk, std::size_t begin, std::size_t end) {
+            kept[chunk] = count_survivors<Unroll>(in + begin, end - begin, pred, last[chunk]);
+        };
+        run_parallel_chunks(count, chunks, count_chunk);
+
+        std::vector<std::size_t> offset(chunks + 1);
+        for (std::size_t chunk = 0; chunk < chunks; ++chunk) { offset[chunk + 1] = offset[chunk] + kept[chunk]; }
+
+        // Pass 2: each chunk stops at its last survivor, so its rejected stores
+        // stay below the next chunk's offset.
+        auto write_chunk = [&offset, &last, &pred, in, out](
+                             std::size_t chunk, std::size_t begin, std::size_t /*end*/) {
+            compact_serial<Unroll>(in + begin, last[chunk], out + offset[chunk], pred);
+        };
+        run_parallel_chunks(count, chunks, write_chunk);
+        return offset[chunks];
+    }
+
+}// namespace detail
+
+/// \brief Copies the elements of `in[0..count)` that satisfy `pred` to `out`, in
+/// order, and returns how many were copied.
+///
+/// `out` must have room for `count` elements: rejected elements are stored at
+/// the cursor before being overwritten, so positions past the survivors are
+/// clobbered. `out` may equal `in` to filter in place. `T` must be trivially
+/// copyable.
+///
+/// With `threads > 1`, inputs of at least 32Ki elements per thread are split
+/// across that many threads. Then `pred` is called twice per element, from
+/// several threads, so it must be pure, thread-safe, and must not throw.
+/// Overlapping `in` and `out` always run on the calling thread.
+template<std::size_t Unroll = 4, typename T, typename Pred>
+auto compact(const T *in,
+  std::size_t count,
+  T *out,
+  Pred &&pred,// NOLINT(cppcoreguidelines-missing-std-forward) — used by lvalue ref
+  std::size_t threads = 1) -> std::size_t {
+    return detail::compact_impl<Unroll>(in, count, out, pred, threads);
+}
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+
+/// \brief `compact` from a span into `out`, which needs room for `in.size()` elements.
+template<std::size_t Unroll = 4, typename T, std::size_t Extent, typename Pred>
+auto compact(std::span<T, Extent> in,
+  std::remove_cv_t<T> *out,
+  Pred &&pred,// NOLINT(cppcoreguidelines-missing-std-forward) — used by lvalue ref
+  std::size_t threads = 1) -> std::size_t {
+    return detail::compact_impl<Unroll>(
+      static_cast<const std::remove_cv_t<T> *>(in.data()), in.size(), out, pred, threads);
+}
+
+#endif
+
+}// namespace poet
@@ -6,6 +6,8 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <optional>
 #include <stdexcept>
 #include <tuple>
@@ -21,6 +23,14 @@ namespace poet {
 /// \brief Concise tuple syntax for `dispatch_set`.
 template<auto... Vs> struct tuple_ {};
 
+/// \brief `dispatch_set` entry allowing every combination of per-dimension `int` sequences,
+/// e.g. `product_<inclusive_range<1, 64>, std::integer_sequence<int, 4, 8>>`.
+template<typename... Dims> struct product_ {};
+
+/// \brief `product_` restricted to the combinations where `Pred{}(v0, v1, ...)` is true;
+/// `Pred` must be default-constructible with a `constexpr` call operator.
+template<typename Pred, typename... Dims> struct where_ {};
+
 namespace detail {
 
     template<typename T>
@@ -72,6 +82,31 @@ namespace detail {
     template<int Start, int... Is>
     auto inclusive_range_impl(std::integer_sequence<int, Is...>) -> std::integer_sequence<int, (Start + Is)...>;
 
+    template<int Start, int End, int Ratio> POET_CPP20_CONSTEVAL auto geometric_count() -> int {
+        static_assert(Start > 0, "geometric_range requires Start > 0");
+        static_assert(Ratio >= 2, "geometric_range requires Ratio >= 2");
+        static_assert(Start <= End, "geometric_range requires Start <= End");
+        int count = 1;
+        // Divide instead of multiply so terms near INT_MAX never overflow.
+        for (int term = Start; term <= End / Ratio; term *= Ratio) { ++count; }
+        return count;
+    }
+
+    template<int Start, int Ratio> POET_CPP20_CONSTEVAL auto geometric_term(int exponent) -> int {
+        int term = Start;
+        for (int i = 0; i < exponent; ++i) { term *= Ratio; }
+        return term;
+    }
+
+    template<int Start, int Ratio, int... Is>
+    auto geometric_range_impl(std::integer_sequence<int, Is...>)
+      -> std::integer_sequence<int, geometric_term<Start, Ratio>(Is)...>;
+
+    template<int Lo> struct pow2_range_check {
+        static_assert(Lo > 0 && (Lo & (Lo - 1)) == 0, "pow2_range requires Lo to be a positive power of two");
+        static constexpr int value = Lo;
+    };
+
 }// namespace detail
 
 /// \brief Inclusive integer sequence `[Start, End]`.
@@ -79,6 +114,18 @@ template<int Start, int End>
 using inclusive_range =
   decltype(detail::inclusive_range_impl<Start>(std::make_integer_sequence<int, End - Start + 1>{}));
 
+/// \brief Geometric sequence `Start, Start*Ratio, Start*Ratio^2, ...` up to `End`.
+///
+/// When `Ratio` is a power of two, lookups reduce to a trailing-zero count
+/// instead of a binary search.
+template<int Start, int End, int Ratio = 2>
+using geometric_range = decltype(detail::geometric_range_impl<Start, Ratio>(
+  std::make_integer_sequence<int, detail::geometric_count<Start, End, Ratio>()>{}));
+
+/// \brief All powers of two in `[Lo, Hi]`; `Lo` must itself be a power of two.
+template<int Lo, int Hi>
+using pow2_range = geometric_range<detail::pow2_range_check<Lo>::value, Hi, 2>;
+
 /// \brief Runtime value paired with the compile-time candidates to probe.
 template<typename Seq> struct dispatch_param {
     int runtime_val;
@@ -222,10 +269,34 @@ namespace detail {
             if (idx < len) { return idx; }
             return dispatch_npos;
         }
+
+        // Slot of the smallest value >= `value`: anything below the range rounds up to its
+        // minimum, everything else is an exact lookup.
+        static POET_FORCEINLINE auto find_ceil(int value) -> std::size_t {
+            constexpr int lowest = std::min({ Values... });
+            return find(value < lowest ? lowest : value);
+        }
+    };
+
+    /// Strategy used by `seq_lookup` for a non-contiguous sequence.
+    enum class sparse_lookup_kind : unsigned char {
+        strided,///< uniform positive stride: div/mod
+        geometric,///< power-of-two ratio: trailing-zero count
+        direct_table,///< narrow key span: one load from a value -> slot table
+        linear_scan,///< few keys: branch-free compare over all keys
+        eytzinger,///< many keys: branch-free search over a BFS-ordered tree
     };
 
-    // Non-contiguous sequences: detect a uniform positive stride at compile time and
-    // specialise `find` to a div/mod (strided) instead of a binary search (truly sparse).
+    /// Largest `max - min + 1` served by a direct value -> slot table.
+    inline constexpr std::size_t sparse_direct_max_span = 512;
+    /// Largest key count served by the branch-free compare scan.
+    inline constexpr std::size_t sparse_scan_max_keys = 32;
+
+    // Non-contiguous sequences: detect a uniform positive stride or a power-of-two ratio at
+    // compile time and specialise `find` to a div/mod (strided) or a trailing-zero count
+    // (geometric). Remaining (truly sparse) sets pick a direct table, a compare scan or an
+    // Eytzinger search from their span and size, so `find` never needs a mispredicting
+    // binary search.
     template<int... Values> struct seq_lookup<std::integer_sequence<int, Values...>, false> {
         using sparse_data = sparse_index<std::integer_sequence<int, Values...>>;
 
@@ -233,20 +304,155 @@ namespace detail {
             if constexpr (sparse_data::unique_count < 2) {
                 return false;
             } else {
-                // Reject non-positive strides up front so `find` can use unsigned math.
-                constexpr int stride0 = sparse_data::keys[1] - sparse_data::keys[0];
-                if constexpr (stride0 <= 0) { return false; }
-                // cppcheck-suppress syntaxError
-                // All adjacent gaps must match `stride0`, otherwise fall back to binary search.
-                for (std::size_t i = 2; i < sparse_data::unique_count; ++i) {
-                    if (sparse_data::keys[i] - sparse_data::keys[i - 1] != stride0) { return false; }
+                // Gaps are measured in `long long`: keys may span the whole int range. `find`
+                // computes `value - first` in int, so the total span must fit as well.
+                using wide = long long;// NOLINT(google-runtime-int)
+                constexpr wide first = sparse_data::keys[0];
+                constexpr wide last = sparse_data::keys[sparse_data::unique_count - 1];
+                if constexpr (last - first > wide{ std::numeric_limits<int>::max() }) {
+                    return false;
+                } else {
+                    // Reject non-positive strides up front so `find` can use unsigned math.
+                    constexpr int stride0 = sparse_data::keys[1] - sparse_data::keys[0];
+                    if constexpr (stride0 <= 0) { return false; }
+                    // cppcheck-suppress syntaxError
+                    // All adjacent gaps must match `stride0`, otherwise fall back to a sparse lookup.
+                    for (std::size_t i = 2; i < sparse_data::unique_count; ++i) {
+                        if (sparse_data::keys[i] - sparse_data::keys[i - 1] != stride0) { return false; }
+                    }
+                    return true;
+                }
+            }
+        }();
+
+        // log2 of a common power-of-two ratio between adjacent positive keys, or 0 when the
+        // keys do not form such a geometric progression (e.g. {1, 2, 4, ..., 1024}).
+        static constexpr unsigned int geometric_shift = []() constexpr -> unsigned int {
+            if constexpr (sparse_data::unique_count < 2 || is_strided) {
+                return 0;
+            } else {
+                if (sparse_data::keys[0] <= 0) { return 0; }
+                const int ratio = sparse_data::keys[1] / sparse_data::keys[0];
+                if (ratio < 2 || (ratio & (ratio - 1)) != 0) { return 0; }
+                // Division-based check so the comparison never overflows near INT_MAX.
+                for (std::size_t i = 1; i < sparse_data::unique_count; ++i) {
+                    if (sparse_data::keys[i] % ratio != 0 || sparse_data::keys[i] / ratio != sparse_data::keys[i - 1]) {
+                        return 0;
+                    }
+                }
+                unsigned int shift = 0;
+                while ((1 << shift) < ratio) { ++shift; }
+                return shift;
+            }
+        }();
+
+        static constexpr bool is_geometric = geometric_shift != 0;
+
+        // Unsigned difference so spans covering most of the int range do not overflow.
+        static constexpr std::size_t key_span =
+          static_cast<std::size_t>(static_cast<unsigned int>(sparse_data::keys[sparse_data::unique_count - 1])
+                                   - static_cast<unsigned int>(sparse_data::keys[0]))
+          + 1;
+
+        static constexpr sparse_lookup_kind kind = []() constexpr -> sparse_lookup_kind {
+            if (is_geometric) { return sparse_lookup_kind::geometric; }
+            if (is_strided) { return sparse_lookup_kind::strided; }
+            if (key_span <= sparse_direct_max_span) { return sparse_lookup_kind::direct_table; }
+            if (sparse_data::unique_count <= sparse_scan_max_keys) { return sparse_lookup_kind::linear_scan; }
+            return sparse_lookup_kind::eytzinger;
+        }();
+
+        // Narrowest type that holds every declared slot plus a miss sentinel, to keep the
+        // direct and Eytzinger tables small in cache.
+        using slot_t = std::conditional_t<(sparse_data::value_count < 0xFFU),
+          std::uint8_t,
+          std::conditional_t<(sparse_data::value_count < 0xFFFFU), std::uint16_t, std::uint32_t>>;
+        static constexpr auto slot_miss = static_cast<slot_t>(-1);
+
+        static constexpr std::size_t direct_size = kind == sparse_lookup_kind::direct_table ? key_span : 1;
+
+        static constexpr std::array<slot_t, direct_size> direct_table = []() constexpr {
+            std::array<slot_t, direct_size> out{};
+            for (auto &slot : out) { slot = slot_miss; }
+            if constexpr (kind == sparse_lookup_kind::direct_table) {
+                for (std::size_t i = 0; i < sparse_data::unique_count; ++i) {
+                    const auto ukey = static_cast<unsigned int>(sparse_data::keys[i]);
+                    const auto ufirst = static_cast<unsigned int>(sparse_data::keys[0]);
+                    const auto offset = static_cast<std::size_t>(ukey - ufirst);
+                    out[offset] = static_cast<slot_t>(sparse_data::indices[i]);
+                }
+            }
+            return out;
+        }();
+
+        // Eytzinger layout: the sorted keys stored in BFS order of an implicit complete binary
+        // tree (node k has children 2k and 2k+1, index 0 unused), padded with INT_MAX so every
+        // search runs exactly `eytzinger_levels` branch-free steps.
+        static constexpr std::size_t eytzinger_levels = []() constexpr -> std::size_t {
+            std::size_t levels = 0;
+            while ((std::size_t{ 1 } << levels) - 1 < sparse_data::unique_count) { ++levels; }
+            return levels;
+        }();
+        static constexpr std::size_t eytzinger_size =
+          kind == sparse_lookup_kind::eytzinger ? (std::size_t{ 1 } << eytzinger_levels) : 1;
+
+        struct eytzinger_data_t {
+            std::array<int, eytzinger_size> keys{};
+            std::array<slot_t, eytzinger_size> slots{};
+        };
+
+        static constexpr eytzinger_data_t eytzinger_data = []() constexpr -> eytzinger_data_t {
+            eytzinger_data_t out{};
+            if constexpr (kind == sparse_lookup_kind::eytzinger) {
+                const std::size_t nodes = eytzinger_size - 1;
+                // In-order walk of the implicit tree assigns sorted keys to nodes.
+                std::size_t node = 1;
+                while (2 * node <= nodes) { node *= 2; }
+                for (std::size_t rank = 0; rank < nodes; ++rank) {
+                    if (rank < sparse_data::unique_count) {
+                        out.keys[node] = sparse_data::keys[rank];
+                        out.slots[node] = static_cast<slot_t>(sparse_data::indices[rank]);
+                    } else {
+                        out.keys[node] = std::numeric_limits<int>::max();
+                        out.slots[node] = slot_miss;
+                    }
+                    // In-order successor: leftmost node of the right subtree, or climb past
+                    // every ancestor reached from its right child.
+                    if (2 * node + 1 <= nodes) {
+                        node = 2 * node + 1;
+                        while (2 * node <= nodes) { node *= 2; }
+                    } else {
+                        while ((node & 1U) != 0U) { node >>= 1U; }
+                        node >>= 1U;
+                    }
                 }
-                return true;
             }
+            return out;
         }();
 
         static POET_FORCEINLINE auto find(int value) -> std::size_t {
-            if constexpr (is_strided) {
+            if constexpr (is_geometric) {
+                // Every key is `first << (k * shift)`: a hit must share the first key's odd
+                // part, and its extra trailing zeros give the exponent directly.
+                static constexpr auto first = static_cast<unsigned int>(sparse_data::keys[0]);
+                static constexpr unsigned int first_tz = []() constexpr -> unsigned int {
+                    unsigned int tz = 0;
+                    while (((first >> tz) & 1U) == 0U) { ++tz; }
+                    return tz;
+                }();
+                static constexpr unsigned int first_odd = first >> first_tz;
+                if (value <= 0) { return dispatch_npos; }
+                const auto uval = static_cast<unsigned int>(value);
+                const unsigned int tz = poet_count_trailing_zeros(uval);
+                if ((uval >> tz) != first_odd || tz < first_tz) { return dispatch_npos; }
+                const unsigned int exponent = tz - first_tz;
+                if constexpr (geometric_shift > 1) {
+                    if (exponent % geometric_shift != 0) { return dispatch_npos; }
+                }
+                const auto idx = static_cast<std::size_t>(exponent / geometric_shift);
+                if (idx < sparse_data::unique_count) { return sparse_data::indices[idx]; }
+                return dispatch_npos;
+            } else if constexpr (is_strided) {
                 static constexpr int first = sparse_data::keys[0];
                 static constexpr int stride = sparse_data::keys[1] - sparse_data::keys[0];
                 const int diff = value - first;
@@ -256,14 +462,50 @@ namespace detail {
                 // Remap sorted position back to the user's declared slot.
                 if (idx < sparse_data::unique_count) { return sparse_data::indices[idx]; }
                 return dispatch_npos;
+            } else if constexpr (kind == sparse_lookup_kind::direct_table) {
+                // Same unsigned-wrap trick as the contiguous path: one bound check covers both sides.
+                const auto offset = static_cast<std::size_t>(
+                  static_cast<unsigned int>(value) - static_cast<unsigned int>(sparse_data::keys[0]));
+                if (offset >= key_span) { return dispatch_npos; }
+                const slot_t slot = direct_table[offset];
+                if (slot == slot_miss) { return dispatch_npos; }
+                return static_cast<std::size_t>(slot);
+            } else if constexpr (kind == sparse_lookup_kind::linear_scan) {
+                // Equality against every key folded into a bitmask; the fixed-size loop has no
+                // data-dependent branch and vectorizes to compare + movemask.
+                unsigned int mask = 0;
+                for (std::size_t i = 0; i < sparse_data::unique_count; ++i) {
+                    mask |= static_cast<unsigned int>(sparse_data::keys[i] == value) << i;
+                }
+                if (mask == 0U) { return dispatch_npos; }
+                return sparse_data::indices[poet_count_trailing_zeros(mask)];
             } else {
-                // Sorted keys → binary search; `indices` undoes the sort to the original slot.
-                const auto pos = std::lower_bound(sparse_data::keys.begin(), sparse_data::keys.end(), value);
-                if (pos != sparse_data::keys.end() && *pos == value) {
-                    return sparse_data::indices[static_cast<std::size_t>(pos - sparse_data::keys.begin())];
+                std::size_t node = 1;
+                for (std::size_t level = 0; level < eytzinger_levels; ++level) {
+                    node = (2 * node) + static_cast<std::size_t>(eytzinger_data.keys[node] < value);
                 }
-                return dispatch_npos;
+                // The walk went right after the last node whose key is >= value; strip those
+                // trailing right turns (ones) plus one more bit to land on that node.
+                node >>= poet_count_trailing_zeros(~node) + 1U;
+                if (node == 0 || eytzinger_data.keys[node] != value) { return dispatch_npos; }
+                const slot_t slot = eytzinger_data.slots[node];
+                if (slot == slot_miss) { return dispatch_npos; }
+                return static_cast<std::size_t>(slot);
+            }
+        }
+
+        // Slot of the smallest value >= `value`. The rank of the ceiling in sorted order is
+        // the number of keys below `value`; small sets count it branch-free.
+        static POET_FORCEINLINE auto find_ceil(int value) -> std::size_t {
+            std::size_t rank = 0;
+            if constexpr (sparse_data::unique_count <= 16) {
+                for (const int key : sparse_data::keys) { rank += static_cast<std::size_t>(key < value); }
+            } else {
+                const auto pos = std::lower_bound(sparse_data::keys.begin(), sparse_data::keys.end(), value);
+                rank = static_cast<std::size_t>(pos - sparse_data::keys.begin());
             }
+            if (rank < sparse_data::unique_count) { return sparse_data::indices[rank]; }
+            return dispatch_npos;
         }
     };
 
@@ -438,6 +680,23 @@ namespace detail {
     struct can_use_value_form<Functor, Value, arg_pack<Args...>>
       : std::bool_constant<std::is_invocable_v<Functor &, std::integral_constant<int, Value>, Args &&...>> {};
 
+    template<int Rank> struct call_form_rank : call_form_rank<Rank - 1> {};
+    template<> struct call_form_rank<0> {};
+
+    // Calls one specialization directly, value form first as in the tables:
+    // functor(integral_constant<int, V>..., args...), else functor.template operator()<V...>(args...).
+    template<int... Vs, typename Functor, typename... Args>
+    POET_FORCEINLINE constexpr auto call_specialized(call_form_rank<1> /*rank*/, Functor &functor, Args &&...args)
+      -> decltype(functor(std::integral_constant<int, Vs>{}..., std::forward<Args>(args)...)) {
+        return functor(std::integral_constant<int, Vs>{}..., std::forward<Args>(args)...);
+    }
+
+    template<int... Vs, typename Functor, typename... Args>
+    POET_FORCEINLINE constexpr auto call_specialized(call_form_rank<0> /*rank*/, Functor &functor, Args &&...args)
+      -> decltype(functor.template operator()<Vs...>(std::forward<Args>(args)...)) {
+        return functor.template operator()<Vs...>(std::forward<Args>(args)...);
+    }
+
     template<typename Functor, typename ArgPack, typename R, int... Values> struct table_builder;
 
     template<typename Functor, typename... Args, typename R, int... Values>
@@ -474,6 +733,18 @@ namespace detail {
             using fn_type = decltype(make_entry<first_value>());
             return std::array<fn_type, sizeof...(Values)>{ make_entry<Values>()... };
         }
+
+        static constexpr std::array<int, sizeof...(Values)> values = { Values... };
+
+        /// Thunk for declared slot `Slot`, for callers that avoid materialising the table.
+        template<std::size_t Slot> static POET_CPP20_CONSTEVAL auto entry_at() { return make_entry<values[Slot]>(); }
+    };
+
+    template<typename Functor, typename ArgPack, typename R, typename Seq> struct table_builder_for;
+
+    template<typename Functor, typename ArgPack, typename R, int... Values>
+    struct table_builder_for<Functor, ArgPack, R, std::integer_sequence<int, Values...>> {
+        using type = table_builder<Functor, ArgPack, R, Values...>;
     };
 
     template<typename Functor, typename ArgPack, typename R, int... Values>
@@ -540,6 +811,14 @@ namespace detail {
             }
         };
 
+        template<typename R, std::size_t FlatIdx> static constexpr auto entry_at() {
+            if constexpr (is_stateless_v<Functor>) {
+                return &nd_index_caller<FlatIdx>::template call_stateless<R>;
+            } else {
+                return &nd_index_caller<FlatIdx>::template call<R>;
+            }
+        }
+
         template<typename R> static constexpr auto make_table() {
             if constexpr (is_stateless_v<Functor>) {
                 using fn_type = decltype(&nd_index_caller<0>::template call_stateless<R>);
@@ -555,16 +834,385 @@ namespace detail {
         }
     };
 
+    template<typename SeqTuple> struct seq_tuple_size;
+
+    template<typename... Seqs>
+    struct seq_tuple_size<std::tuple<Seqs...>>
+      : std::integral_constant<std::size_t, (sequence_size<Seqs>::value * ... * 1)> {};
+
     template<typename Functor, typename ArgPack, typename R, typename... Seqs>
     POET_CPP20_CONSTEVAL auto make_nd_dispatch_table(std::tuple<Seqs...> /*seqs*/) {
-        constexpr std::size_t total_size = (sequence_size<Seqs>::value * ... * 1);
+        constexpr std::size_t total_size = seq_tuple_size<std::tuple<Seqs...>>::value;
         return nd_table_builder<Functor, ArgPack, std::tuple<Seqs...>, std::make_index_sequence<total_size>>::
           template make_table<R>();
     }
 
+    // ------------------------------------------------------------------------
+    // Compressed N-D tables
+    // ------------------------------------------------------------------------
+    // A functor can narrow its N-D product with two optional static members:
+    //   static constexpr bool dispatch_valid(int v0, int v1, ...);  // combination is legal
+    //   using dispatch_ignored_dims = std::index_sequence<D...>;      // dims the body ignores
+    // Either one makes dispatch use a two-level table: a narrow per-combination slot, then
+    // one thunk per distinct instantiation. Invalid combinations take the miss path without
+    // instantiating anything, and combinations that differ only in ignored dims share the
+    // instantiation at that dimension's first value.
+    template<typename Functor, typename DimIdx, typename = void> struct has_dispatch_valid : std::false_type {};
+
+    template<typename Functor, std::size_t... Dims>
+    struct has_dispatch_valid<Functor,
+      std::index_sequence<Dims...>,
+      std::void_t<decltype(Functor::dispatch_valid((static_cast<void>(Dims), 0)...))>> : std::true_type {};
+
+    template<typename Functor, typename = void> struct ignored_dims_of {
+        using type = std::index_sequence<>;
+    };
+
+    template<typename Functor>
+    struct ignored_dims_of<Functor, std::void_t<typename Functor::dispatch_ignored_dims>> {
+        using type = typename Functor::dispatch_ignored_dims;
+    };
+
+    template<typename Functor, std::size_t Rank>
+    inline constexpr bool uses_compressed_table_v = has_dispatch_valid<Functor, std::make_index_sequence<Rank>>::value
+                                                    || !std::is_same_v<typename ignored_dims_of<Functor>::type,
+                                                      std::index_sequence<>>;
+
+    template<typename Seq> struct sequence_values;
+
+    template<int... Values> struct sequence_values<std::integer_sequence<int, Values...>> {
+        static constexpr std::array<int, sizeof...(Values)> value = { Values... };
+    };
+
+    template<std::size_t Rank, std::size_t... Ignored>
+    POET_CPP20_CONSTEVAL auto ignored_mask(std::index_sequence<Ignored...> /*dims*/) -> std::array<bool, Rank> {
+        static_assert(((Ignored < Rank) && ...), "dispatch_ignored_dims names a dimension past the last parameter");
+        std::array<bool, Rank> mask{};
+        ((mask[Ignored] = true), ...);
+        return mask;
+    }
+
+    template<typename Functor, typename SeqTuple> struct nd_slot_map;
+
+    template<typename Functor, typename... Seqs> struct nd_slot_map<Functor, std::tuple<Seqs...>> {
+        static constexpr std::size_t rank = sizeof...(Seqs);
+        static constexpr std::size_t total = (sequence_size<Seqs>::value * ... * 1);
+        static constexpr std::array<std::size_t, rank> dims = { sequence_size<Seqs>::value... };
+        static constexpr std::array<std::size_t, rank> strides = compute_strides(dims);
+        static constexpr std::array<bool, rank> ignored =
+          ignored_mask<rank>(typename ignored_dims_of<Functor>::type{});
+
+        using slot_t = std::conditional_t<(total < 0xFFU),
+          std::uint8_t,
+          std::conditional_t<(total < 0xFFFFU), std::uint16_t, std::uint32_t>>;
+        static constexpr slot_t slot_miss = std::numeric_limits<slot_t>::max();
+
+        template<std::size_t... Dims>
+        static constexpr auto is_valid(std::size_t flat, std::index_sequence<Dims...> /*dims*/) -> bool {
+            if constexpr (has_dispatch_valid<Functor, std::index_sequence<Dims...>>::value) {
+                return Functor::dispatch_valid(
+                  sequence_values<Seqs>::value[flat / strides[Dims] % dims[Dims]]...);
+            } else {
+                return true;
+            }
+        }
+
+        // Flat index with every ignored coordinate moved to the dimension's first value.
+        static constexpr auto canonical(std::size_t flat) -> std::size_t {
+            std::size_t out = flat;
+            for (std::size_t d = 0; d < rank; ++d) {
+                if (ignored[d]) { out -= flat / strides[d] % dims[d] * strides[d]; }
+            }
+            return out;
+        }
+
+        struct layout_t {
+            std::array<slot_t, total> slots{};
+            std::array<std::size_t, total> owners{};
+            std::size_t unique = 0;
+        };
+
+        static constexpr layout_t layout = []() constexpr -> layout_t {
+            layout_t out{};
+            std::array<bool, total> needed{};
+            for (std::size_t flat = 0; flat < total; ++flat) {
+                if (is_valid(flat, std::make_index_sequence<rank>{})) { needed[canonical(flat)] = true; }
+            }
+            std::array<slot_t, total> slot_of{};
+            for (std::size_t flat = 0; flat < total; ++flat) {
+                if (needed[flat]) {
+                    slot_of[flat] = static_cast<slot_t>(out.unique);
+                    out.owners[out.unique++] = flat;
+                }
+            }
+            for (std::size_t flat = 0; flat < total; ++flat) {
+                out.slots[flat] =
+                  is_valid(flat, std::make_index_sequence<rank>{}) ? slot_of[canonical(flat)] : slot_miss;
+            }
+            return out;
+        }();
+
+        static constexpr std::size_t unique_count = layout.unique;
+        static_assert(unique_count > 0, "dispatch_valid rejects every combination");
+
+        static constexpr std::array<slot_t, total> slots = layout.slots;
+        static constexpr std::array<std::size_t, unique_count> owners = []() constexpr {
+            std::array<std::size_t, unique_count> out{};
+            for (std::size_t k = 0; k < unique_count; ++k) { out[k] = layout.owners[k]; }
+            return out;
+        }();
+
+        /// Thunk slot for flat combination `flat`, or `dispatch_npos` if it is out of range or invalid.
+        static POET_FORCEINLINE auto find(std::size_t flat) -> std::size_t {
+            if (POET_UNLIKELY(flat >= total)) { return dispatch_npos; }
+            const slot_t slot = slots[flat];
+            return slot == slot_miss ? dispatch_npos : static_cast<std::size_t>(slot);
+        }
+    };
+
+    template<typename R, typename Builder, typename SlotMap, std::size_t... Slots>
+    POET_CPP20_CONSTEVAL auto make_compressed_table(std::index_sequence<Slots...> /*slots*/) {
+        // Flat index 0 may be an invalid combination, so take the type from the first live slot.
+        using fn_type = decltype(Builder::template entry_at<R, SlotMap::owners[0]>());
+        return std::array<fn_type, sizeof...(Slots)>{ Builder::template entry_at<R, SlotMap::owners[Slots]>()... };
+    }
+
+    // ------------------------------------------------------------------------
+    // dispatch_set range entries
+    // ------------------------------------------------------------------------
+    // A set with `product_` / `where_` entries is compiled to an N-D dispatch over per-dimension
+    // axes (the sorted union of every value an entry allows in that dimension), so each runtime
+    // value costs one `seq_lookup`. A compressed `nd_slot_map` then rejects combinations no entry
+    // covers, and only covered combinations are instantiated.
+    template<typename Entry> struct set_entry;
+
+    template<auto... Vs> struct set_entry<tuple_<Vs...>> {
+        static constexpr std::size_t arity = sizeof...(Vs);
+        using dims = std::tuple<std::integer_sequence<int, static_cast<int>(Vs)>...>;
+        static constexpr bool is_range = false;
+        template<std::size_t N> static constexpr auto accepts(const std::array<int, N> & /*point*/) -> bool {
+            return true;
+        }
+    };
+
+    template<typename... Dims> struct set_entry<product_<Dims...>> {
+        static constexpr std::size_t arity = sizeof...(Dims);
+        using dims = std::tuple<Dims...>;
+        static constexpr bool is_range = true;
+        template<std::size_t N> static constexpr auto accepts(const std::array<int, N> & /*point*/) -> bool {
+            return true;
+        }
+    };
+
+    template<typename Pred, typename... Dims> struct set_entry<where_<Pred, Dims...>> {
+        static constexpr std::size_t arity = sizeof...(Dims);
+        using dims = std::tuple<Dims...>;
+        static constexpr bool is_range = true;
+
+        template<std::size_t N, std::size_t... Is>
+        static constexpr auto accepts_impl(const std::array<int, N> &point, std::index_sequence<Is...> /*idxs*/)
+          -> bool {
+            return Pred{}(point[Is]...);
+        }
+
+        template<std::size_t N> static constexpr auto accepts(const std::array<int, N> &point) -> bool {
+            return accepts_impl(point, std::make_index_sequence<N>{});
+        }
+    };
+
+    template<typename... Seqs> struct concat_sequences;
+
+    template<> struct concat_sequences<> {
+        using type = std::integer_sequence<int>;
+    };
+
+    template<int... A> struct concat_sequences<std::integer_sequence<int, A...>> {
+        using type = std::integer_sequence<int, A...>;
+    };
+
+    template<int... A, int... B, typename... Rest>
+    struct concat_sequences<std::integer_sequence<int, A...>, std::integer_sequence<int, B...>, Rest...> {
+        using type = typename concat_sequences<std::integer_sequence<int, A..., B...>, Rest...>::type;
+    };
+
+    template<typename Index, typename IdxSeq> struct sorted_keys_sequence;
+
+    template<typename Index, std::size_t... Is> struct sorted_keys_sequence<Index, std::index_sequence<Is...>> {
+        using type = std::integer_sequence<int, Index::keys[Is]...>;
+    };
+
+    /// Sorted, de-duplicated union of the values every entry allows in dimension `Dim`.
+    template<std::size_t Dim, typename... Entries> struct set_axis {
+        using values =
+          typename concat_sequences<std::tuple_element_t<Dim, typename set_entry<Entries>::dims>...>::type;
+        using index = sparse_index<values>;
+        using type = typename sorted_keys_sequence<index, std::make_index_sequence<index::unique_count>>::type;
+    };
+
+    template<std::size_t D, typename Entry, std::size_t N>
+    constexpr auto dim_contains(const std::array<int, N> &point) -> bool {
+        for (const int v : sequence_values<std::tuple_element_t<D, typename set_entry<Entry>::dims>>::value) {
+            if (v == point[D]) { return true; }
+        }
+        return false;
+    }
+
+    template<typename Entry, std::size_t N, std::size_t... Ds>
+    constexpr auto entry_contains(const std::array<int, N> &point, std::index_sequence<Ds...> /*dims*/) -> bool {
+        return (dim_contains<Ds, Entry>(point) && ...) && set_entry<Entry>::accepts(point);
+    }
+
+    template<typename IdxSeq, typename... Entries> struct set_layout_impl;
+
+    template<std::size_t... Ds, typename... Entries> struct set_layout_impl<std::index_sequence<Ds...>, Entries...> {
+        using axes = std::tuple<typename set_axis<Ds, Entries...>::type...>;
+
+        static constexpr auto contains(const std::array<int, sizeof...(Ds)> &point) -> bool {
+            return (entry_contains<Entries>(point, std::index_sequence<Ds...>{}) || ...);
+        }
+    };
+
+    template<typename... Entries>
+    using set_layout = set_layout_impl<
+      std::make_index_sequence<set_entry<std::tuple_element_t<0, std::tuple<Entries...>>>::arity>,
+      Entries...>;
+
+    // `nd_slot_map` policy for a range set: a combination is live when some entry covers it and
+    // the functor's own `dispatch_valid` (if any) accepts it. Ignored dims come from the functor.
+    template<typename Functor, typename Layout> struct set_policy {
+        using dispatch_ignored_dims = typename ignored_dims_of<Functor>::type;
+
+        template<typename... V> static constexpr auto dispatch_valid(V... values) -> bool {
+            if constexpr (has_dispatch_valid<Functor, std::index_sequence_for<V...>>::value) {
+                if (!Functor::dispatch_valid(values...)) { return false; }
+            }
+            return Layout::contains(std::array<int, sizeof...(V)>{ values... });
+        }
+    };
+
+    // ------------------------------------------------------------------------
+    // Relocation-free slot invocation
+    // ------------------------------------------------------------------------
+    // A `static constexpr` array of function pointers needs one dynamic relocation per entry
+    // in PIE/shared builds and lands in `.data.rel.ro`. With POET_DISPATCH_RELATIVE_TABLES
+    // the slot is instead resolved through nested dense `switch` statements (fan-out 64,
+    // depth log64(N)); GCC and Clang lower those to jump tables of 32-bit relative offsets
+    // in `.rodata`, which need no relocations and take half the space. The macro changes
+    // generated code, so it must be set identically in every translation unit.
+#if defined(POET_DISPATCH_RELATIVE_TABLES) && POET_DISPATCH_RELATIVE_TABLES
+    inline constexpr bool use_relative_tables = true;
+#else
+    inline constexpr bool use_relative_tables = false;
+#endif
+
+    // When inlining turns the key into a constant (a literal argument, or LTO across units),
+    // the slot invokers route it through `switch_invoke`, which folds to a direct call the
+    // compiler can inline. Runtime keys keep the table. The switch is instantiated and inlined
+    // at every dispatch site, constant key or not, so it is only emitted for tables of at most
+    // `constant_key_max_slots` entries (one switch level). For a 512-entry table it cost about
+    // a third more compile time per unit (GCC 12, -O2: 19.4 s against 14.8 s).
+    // POET_DISPATCH_CONSTANT_KEYS=0 turns it off for small tables too.
+#if !defined(POET_DISPATCH_CONSTANT_KEYS) || POET_DISPATCH_CONSTANT_KEYS
+    inline constexpr bool constant_key_fast_path = true;
+#else
+    inline constexpr bool constant_key_fast_path = false;
+#endif
+
+    // With POET_DISPATCH_STATS, `dispatch` bumps a per-thread counter for the slot it resolved
+    // (or a miss counter); see dispatch_stats.hpp. Like the relative tables, the macro must be
+    // set identically in every translation unit; without it no counting code is emitted.
+#if defined(POET_DISPATCH_STATS) && POET_DISPATCH_STATS
+    inline constexpr bool dispatch_stats_enabled = true;
+#else
+    inline constexpr bool dispatch_stats_enabled = false;
+#endif
+
+    template<typename Functor, typename SeqTuple> struct stats_product_site;
+    template<typename Functor, typename TupleList> struct stats_tuple_site;
+
+    /// Counts one dispatch through `Site`; `slot` is `dispatch_npos` on a miss.
+    template<typename Site> inline void record_dispatch(std::size_t slot);
+
+    inline constexpr std::size_t switch_fanout = 64;
+
+    inline constexpr std::size_t constant_key_max_slots = switch_fanout;
+
+    // Whether a table of `Count` slots gets the constant-key switch.
+    template<std::size_t Count>
+    inline constexpr bool constant_key_switch_v = constant_key_fast_path && Count <= constant_key_max_slots;
+
+    template<std::size_t Count> POET_CPP20_CONSTEVAL auto switch_chunk() -> std::size_t {
+        // Power-of-two chunk so the outer level splits on a shift, never a division.
+        std::size_t chunk = 1;
+        while (chunk * switch_fanout < Count) { chunk *= 2; }
+        return chunk;
+    }
+
+// clang-format off
+// NOLINTBEGIN(cppcoreguidelines-macro-usage)
+#define POET_DETAIL_CASES_4(X, B) X((B)) X((B) + 1) X((B) + 2) X((B) + 3)
+#define POET_DETAIL_CASES_16(X, B)                                                                 \
+    POET_DETAIL_CASES_4(X, B) POET_DETAIL_CASES_4(X, (B) + 4)                                      \
+    POET_DETAIL_CASES_4(X, (B) + 8) POET_DETAIL_CASES_4(X, (B) + 12)
+#define POET_DETAIL_CASES_64(X)                                                                    \
+    POET_DETAIL_CASES_16(X, 0) POET_DETAIL_CASES_16(X, 16) POET_DETAIL_CASES_16(X, 32) POET_DETAIL_CASES_16(X, 48)
+
+#define POET_DETAIL_LEAF_CASE(I)                                                                   \
+    case (I):                                                                                      \
+        if constexpr ((I) < Count) {                                                               \
+            return call(std::integral_constant<std::size_t, Base + (I)>{});                        \
+        } else {                                                                                   \
+            break;                                                                                 \
+        }
+
+#define POET_DETAIL_NODE_CASE(I)                                                                   \
+    case (I):                                                                                      \
+        if constexpr ((I) * chunk < Count) {                                                       \
+            constexpr std::size_t rest = Count - ((I) * chunk);                                    \
+            constexpr std::size_t child_count = rest < chunk ? rest : chunk;                       \
+            return switch_invoke<Base + ((I) * chunk), child_count, R>(idx, call);                 \
+        } else {                                                                                   \
+            break;                                                                                 \
+        }
+// NOLINTEND(cppcoreguidelines-macro-usage)
+// clang-format on
+
+    /// Calls `call(integral_constant<size_t, I>{})` for `I == idx`, `idx` in `[Base, Base + Count)`.
+    template<std::size_t Base, std::size_t Count, typename R, typename Call>
+    POET_FORCEINLINE auto switch_invoke(std::size_t idx, Call &call) -> R {
+        if constexpr (Count <= switch_fanout) {
+            switch (idx - Base) {
+                POET_DETAIL_CASES_64(POET_DETAIL_LEAF_CASE)
+            default:
+                break;
+            }
+        } else {
+            constexpr std::size_t chunk = switch_chunk<Count>();
+            switch ((idx - Base) / chunk) {
+                POET_DETAIL_CASES_64(POET_DETAIL_NODE_CASE)
+            default:
+                break;
+            }
+        }
+        // Callers only pass in-range slots; the unreachable default lets the compiler drop
+        // the jump table's bound check.
+        POET_UNREACHABLE();
+    }
+
+#undef POET_DETAIL_NODE_CASE
+#undef POET_DETAIL_LEAF_CASE
+#undef POET_DETAIL_CASES_64
+#undef POET_DETAIL_CASES_16
+#undef POET_DETAIL_CASES_4
+
 }// namespace detail
 
-/// \brief Exact set of allowed tuples for sparse dispatch.
+/// \brief Set of allowed tuples for sparse dispatch.
+///
+/// Entries are exact points (`tuple_`) or, for `int` sets, per-dimension
+/// ranges (`product_`, `where_`). Point-only sets match by comparing each tuple;
+/// sets with range entries resolve each dimension with one lookup and a small
+/// table, and instantiate only the combinations some entry covers.
 template<typename ValueType, typename... Tuples> struct dispatch_set {
     template<typename TupleHelper> struct convert_tuple;
 
@@ -572,19 +1220,34 @@ template<typename ValueType, typename... Tuples> struct dispatch_set {
         using type = std::integer_sequence<ValueType, static_cast<ValueType>(Vs)...>;
     };
 
+    // Range entries have no single point; they only take the range path below.
+    template<typename... Dims> struct convert_tuple<product_<Dims...>> {
+        using type = std::integer_sequence<ValueType>;
+    };
+
+    template<typename Pred, typename... Dims> struct convert_tuple<where_<Pred, Dims...>> {
+        using type = std::integer_sequence<ValueType>;
+    };
+
     using seq_type = std::tuple<typename convert_tuple<Tuples>::type...>;
     using first_t = std::tuple_element_t<0, seq_type>;
 
     static_assert(sizeof...(Tuples) >= 1, "dispatch_set requires at least one allowed tuple");
 
-    static constexpr std::size_t tuple_arity = detail::sequence_size<first_t>::value;
+    static constexpr bool has_ranges = (detail::set_entry<Tuples>::is_range || ...);
+
+    static_assert(!has_ranges || std::is_same_v<ValueType, int>, "dispatch_set range entries require int values");
 
-    template<typename S> struct same_arity : std::bool_constant<detail::sequence_size<S>::value == tuple_arity> {};
+    static constexpr std::size_t tuple_arity =
+      detail::set_entry<std::tuple_element_t<0, std::tuple<Tuples...>>>::arity;
 
-    static_assert((same_arity<typename convert_tuple<Tuples>::type>::value && ...),
+    static_assert(((detail::set_entry<Tuples>::arity == tuple_arity) && ...),
       "All tuples in dispatch_set must have the same arity");
 
-    static_assert(detail::unique_helper<typename convert_tuple<Tuples>::type...>::value,
+    // Lazy: range entries convert to empty placeholder sequences that cannot be compared.
+    static_assert(std::conditional_t<has_ranges,
+                    std::true_type,
+                    detail::unique_helper<typename convert_tuple<Tuples>::type...>>::value,
       "dispatch_set contains duplicate allowed tuples");
 
     using runtime_array_t = std::array<ValueType, tuple_arity>;
@@ -633,18 +1296,81 @@ namespace detail {
         }
     }
 
+    // Invokes declared slot `idx` of a 1-D sequence, through the pointer table or, with
+    // relative tables enabled, through `switch_invoke`. So does a slot the optimizer has
+    // folded to a constant, in small tables (see `constant_key_fast_path`).
+    template<typename R, typename Seq, typename Functor, typename... Args>
+    POET_FORCEINLINE auto invoke_1d_slot(std::size_t idx, Functor &functor, Args &&...args) -> R {
+        using FunctorT = std::decay_t<Functor>;
+        using builder = typename table_builder_for<FunctorT, arg_pack<Args...>, R, Seq>::type;
+        auto call = [&](auto slot) POET_ALWAYS_INLINE_LAMBDA -> R {
+            constexpr auto entry = builder::template entry_at<decltype(slot)::value>();
+            return invoke_table_entry<R>(functor, entry, std::forward<Args>(args)...);
+        };
+        if constexpr (use_relative_tables) {
+            return switch_invoke<0, sequence_size<Seq>::value, R>(idx, call);
+        } else {
+            if constexpr (constant_key_switch_v<sequence_size<Seq>::value>) {
+                if (POET_IS_CONSTANT(idx)) { return switch_invoke<0, sequence_size<Seq>::value, R>(idx, call); }
+            }
+            static constexpr auto table = make_dispatch_table<FunctorT, arg_pack<Args...>, R>(Seq{});
+            return invoke_table_entry<R>(functor, table[idx], std::forward<Args>(args)...);
+        }
+    }
+
+    // `slot` is the flat combination index, or the distinct-instantiation slot from
+    // `nd_slot_map::find` when `Policy` (the functor, or a `dispatch_set` policy) narrows the table.
+    // Constant slots take the switch as in `invoke_1d_slot`.
+    template<typename R, typename SeqTuple, typename Policy, typename Functor, typename... Args>
+    POET_FORCEINLINE auto invoke_nd_slot(std::size_t slot, Functor &functor, Args &&...args) -> R {
+        using FunctorT = std::decay_t<Functor>;
+        constexpr std::size_t total_size = seq_tuple_size<SeqTuple>::value;
+        using builder = nd_table_builder<FunctorT, arg_pack<Args...>, SeqTuple, std::make_index_sequence<total_size>>;
+        if constexpr (uses_compressed_table_v<Policy, std::tuple_size_v<SeqTuple>>) {
+            using slot_map = nd_slot_map<Policy, SeqTuple>;
+            auto call = [&](auto k) POET_ALWAYS_INLINE_LAMBDA -> R {
+                constexpr auto entry = builder::template entry_at<R, slot_map::owners[decltype(k)::value]>();
+                return invoke_table_entry<R>(functor, entry, std::forward<Args>(args)...);
+            };
+            if constexpr (use_relative_tables) {
+                return switch_invoke<0, slot_map::unique_count, R>(slot, call);
+            } else {
+                if constexpr (constant_key_switch_v<slot_map::unique_count>) {
+                    if (POET_IS_CONSTANT(slot)) { return switch_invoke<0, slot_map::unique_count, R>(slot, call); }
+                }
+                static constexpr auto table = make_compressed_table<R, builder, slot_map>(
+                  std::make_index_sequence<slot_map::unique_count>{});
+                return invoke_table_entry<R>(functor, table[slot], std::forward<Args>(args)...);
+            }
+        } else {
+            auto call = [&](auto flat) POET_ALWAYS_INLINE_LAMBDA -> R {
+                constexpr auto entry = builder::template entry_at<R, decltype(flat)::value>();
+                return invoke_table_entry<R>(functor, entry, std::forward<Args>(args)...);
+            };
+            if constexpr (use_relative_tables) {
+                return switch_invoke<0, total_size, R>(slot, call);
+            } else {
+                if constexpr (constant_key_switch_v<total_size>) {
+                    if (POET_IS_CONSTANT(slot)) { return switch_invoke<0, total_size, R>(slot, call); }
+                }
+                static constexpr SeqTuple sequences{};
+                static constexpr auto table = make_nd_dispatch_table<FunctorT, arg_pack<Args...>, R>(sequences);
+                return invoke_table_entry<R>(functor, table[slot], std::forward<Args>(args)...);
+            }
+        }
+    }
+
     template<bool ThrowOnNoMatch, typename R, typename Functor, typename ParamTuple, typename... Args>
     POET_FORCEINLINE auto dispatch_1d(Functor &functor, ParamTuple const &params, Args &&...args) -> R {
         using FirstParam = std::tuple_element_t<0, std::remove_reference_t<ParamTuple>>;
         using Seq = typename FirstParam::seq_type;
         const int runtime_val = std::get<0>(params).runtime_val;
         const std::size_t idx = seq_lookup<Seq>::find(runtime_val);
-
-        if (idx != dispatch_npos) {
-            using FunctorT = std::decay_t<Functor>;
-            static constexpr auto table = make_dispatch_table<FunctorT, arg_pack<Args...>, R>(Seq{});
-            return invoke_table_entry<R>(functor, table[idx], std::forward<Args>(args)...);
+        if constexpr (dispatch_stats_enabled) {
+            record_dispatch<stats_product_site<std::decay_t<Functor>, std::tuple<Seq>>>(idx);
         }
+
+        if (idx != dispatch_npos) { return invoke_1d_slot<R, Seq>(idx, functor, std::forward<Args>(args)...); }
         if constexpr (ThrowOnNoMatch) {
             throw no_match_error("poet::dispatch: no matching compile-time combination for runtime inputs");
         } else if constexpr (!std::is_void_v<R>) {
@@ -652,16 +1378,26 @@ namespace detail {
         }
     }
 
-    template<bool ThrowOnNoMatch, typename R, typename Functor, typename ParamTuple, typename... Args>
+    template<bool ThrowOnNoMatch,
+      typename R,
+      typename Policy,
+      typename Functor,
+      typename ParamTuple,
+      typename... Args>
     POET_FORCEINLINE auto dispatch_nd(Functor &functor, ParamTuple const &params, Args &&...args) -> R {
-        const std::size_t flat_idx = extract_flat_index(params);
-        if (POET_LIKELY(flat_idx != dispatch_npos)) {
-            using sequences_t = decltype(extract_sequences<ParamTuple>());
-            static constexpr sequences_t sequences{};
-
-            using FunctorT = std::decay_t<Functor>;
-            static constexpr auto table = make_nd_dispatch_table<FunctorT, arg_pack<Args...>, R>(sequences);
-            return invoke_table_entry<R>(functor, table[flat_idx], std::forward<Args>(args)...);
+        using sequences_t = decltype(extract_sequences<ParamTuple>());
+        const std::size_t flat = extract_flat_index(params);
+        std::size_t slot = flat;
+        if constexpr (uses_compressed_table_v<Policy, std::tuple_size_v<sequences_t>>) {
+            slot = nd_slot_map<Policy, sequences_t>::find(flat);
+        }
+        if constexpr (dispatch_stats_enabled) {
+            // Keyed by the full-product index so the histogram names each combination.
+            record_dispatch<stats_product_site<std::decay_t<Functor>, sequences_t>>(
+              slot == dispatch_npos ? dispatch_npos : flat);
+        }
+        if (POET_LIKELY(slot != dispatch_npos)) {
+            return invoke_nd_slot<R, sequences_t, Policy>(slot, functor, std::forward<Args>(args)...);
         }
         if constexpr (ThrowOnNoMatch) {
             throw no_match_error("poet::dispatch: no matching compile-time combination for runtime inputs");
@@ -671,15 +1407,76 @@ namespace detail {
     }
 
     template<bool ThrowOnNoMatch, typename Functor, typename ParamTuple, typename... Args>
-    POET_FORCEINLINE auto dispatch_impl(Functor &functor, ParamTuple const &params, Args &&...args) -> decltype(auto) {
+    POET_FORCEINLINE auto dispatch_inline_impl(Functor &functor, ParamTuple const &params, Args &&...args)
+      -> decltype(auto) {
         constexpr std::size_t param_count = std::tuple_size_v<std::remove_reference_t<ParamTuple>>;
         using sequences_t = decltype(extract_sequences<ParamTuple>());
         using result_type = dispatch_result_t<Functor, sequences_t, Args &&...>;
 
-        if constexpr (param_count == 1) {
+        // A single parameter still takes the N-D path when the functor narrows its table.
+        if constexpr (param_count == 1 && !uses_compressed_table_v<std::decay_t<Functor>, 1>) {
             return dispatch_1d<ThrowOnNoMatch, result_type>(functor, params, std::forward<Args>(args)...);
         } else {
-            return dispatch_nd<ThrowOnNoMatch, result_type>(functor, params, std::forward<Args>(args)...);
+            return dispatch_nd<ThrowOnNoMatch, result_type, std::decay_t<Functor>>(
+              functor, params, std::forward<Args>(args)...);
+        }
+    }
+
+    /// Lookup key for `POET_DECLARE_DISPATCH`: the functor, its per-parameter sequences and the
+    /// decayed trailing argument types.
+    template<typename Functor, typename SeqTuple, typename... Args> struct dispatch_key {};
+
+    // Maps a `dispatch_key` to the `dispatch_instance` declared for it; `void` when none is.
+    template<typename Key> struct declared_dispatch {
+        using type = void;
+    };
+
+    // Whether the call's arguments bind to the declared instance's parameters.
+    template<typename Instance, typename Functor, typename ParamTuple, typename... Args>
+    struct declared_accepts
+      : std::is_invocable<decltype(&Instance::invoke), Functor &, ParamTuple const &, Args &&...> {};
+
+    template<typename Functor, typename ParamTuple, typename... Args>
+    struct declared_accepts<void, Functor, ParamTuple, Args...> : std::false_type {};
+
+    // The declared instance a call goes through, or `void` for the inline table. Only a call
+    // whose decayed argument types equal the declared `Args...`, and which binds to them, uses
+    // it; any other call would be converted to the declared signature.
+    template<typename Functor, typename ParamTuple, typename... Args> struct declared_dispatch_for {
+        using candidate = typename declared_dispatch<
+          dispatch_key<Functor, decltype(extract_sequences<ParamTuple>()), std::decay_t<Args>...>>::type;
+        using type =
+          std::conditional_t<declared_accepts<candidate, Functor, ParamTuple, Args...>::value, candidate, void>;
+    };
+
+    template<typename Functor, typename ParamTuple, typename... Args>
+    using declared_dispatch_for_t = typename declared_dispatch_for<Functor, ParamTuple, Args...>::type;
+
+    template<bool ThrowOnNoMatch, typename Instance, typename Functor, typename ParamTuple, typename... Args>
+    POET_FORCEINLINE auto call_declared(Functor &functor, ParamTuple const &params, Args &&...args) ->
+      typename Instance::result_type {
+        if constexpr (ThrowOnNoMatch) {
+            return Instance::invoke_or_throw(functor, params, std::forward<Args>(args)...);
+        } else {
+            return Instance::invoke(functor, params, std::forward<Args>(args)...);
+        }
+    }
+
+    // Routes through the out-of-line instance when the signature was declared extern, so this
+    // translation unit instantiates neither the table nor its thunks.
+    template<bool ThrowOnNoMatch, typename Functor, typename ParamTuple, typename... Args>
+    POET_FORCEINLINE auto dispatch_impl(Functor &functor, ParamTuple const &params, Args &&...args) -> decltype(auto) {
+        using FunctorT = std::decay_t<Functor>;
+        using declared = declared_dispatch_for_t<FunctorT, ParamTuple, Args...>;
+        if constexpr (std::is_void_v<declared>) {
+            return dispatch_inline_impl<ThrowOnNoMatch>(functor, params, std::forward<Args>(args)...);
+        } else if constexpr (std::is_const_v<Functor>) {
+            static_assert(
+              is_stateless_v<FunctorT>, "declared dispatch instances take a stateful functor by non-const reference");
+            FunctorT local{};
+            return call_declared<ThrowOnNoMatch, declared>(local, params, std::forward<Args>(args)...);
+        } else {
+            return call_declared<ThrowOnNoMatch, declared>(functor, params, std::forward<Args>(args)...);
         }
     }
 
@@ -707,8 +1504,11 @@ namespace detail {
         auto all_refs = std::forward_as_tuple(std::forward<All>(all)...);
 
         // Leading `num_params` entries are the dispatch_params → copy into a value tuple
-        // (they're small structs holding a runtime int).
-        auto params = std::make_tuple(std::get<ParamIdx>(all_refs)...);
+        // (they're small structs holding a runtime int). Storing the ints field by field,
+        // rather than copying the structs, lets GCC see constant keys early enough for the
+        // `POET_IS_CONSTANT` fast path in the slot invokers.
+        std::tuple<std::decay_t<std::tuple_element_t<ParamIdx, decltype(all_refs)>>...> params;
+        ((std::get<ParamIdx>(params).runtime_val = std::get<ParamIdx>(all_refs).runtime_val), ...);
 
         // Remaining entries are forwarded with their original value categories preserved
         // via `std::move(all_refs)` (the references inside are unaffected).
@@ -770,6 +1570,67 @@ auto dispatch(Functor &&functor,// NOLINT(cppcoreguidelines-missing-std-forward)
     return detail::dispatch_impl<false>(functor, params, std::forward<Args>(args)...);
 }
 
+/// \brief One `dispatch` signature compiled out of line.
+///
+/// `Signature` is `R(Args...)`: the result and the trailing arguments as the
+/// specializations receive them. Name it through `POET_DECLARE_DISPATCH` in a
+/// header and `POET_DEFINE_DISPATCH` in one source file; matching `dispatch`
+/// calls then cost one extra direct call but no longer instantiate the table.
+/// A call matches when its trailing arguments decay to exactly `Args...`;
+/// calls with other argument types keep the inline table.
+template<typename Functor, typename Signature, typename... Seqs> struct dispatch_instance;
+
+template<typename Functor, typename R, typename... Args, typename... Seqs>
+struct dispatch_instance<Functor, R(Args...), Seqs...> {
+    using key_type = detail::dispatch_key<Functor, std::tuple<Seqs...>, std::decay_t<Args>...>;
+    using params_type = std::tuple<dispatch_param<Seqs>...>;
+    using result_type = R;
+
+    static_assert(std::is_same_v<R, detail::dispatch_result_t<Functor, std::tuple<Seqs...>, Args &&...>>,
+      "dispatch_instance signature must name the functor's result type");
+
+    static auto invoke(Functor &functor, params_type const &params, Args... args) -> R;
+    static auto invoke_or_throw(Functor &functor, params_type const &params, Args... args) -> R;
+};
+
+// Defined out of class (not inline) so an explicit instantiation declaration suppresses them.
+template<typename Functor, typename R, typename... Args, typename... Seqs>
+auto dispatch_instance<Functor, R(Args...), Seqs...>::invoke(Functor &functor,
+  params_type const &params,
+  Args... args) -> R {
+    return detail::dispatch_inline_impl<false>(functor, params, std::forward<Args>(args)...);
+}
+
+template<typename Functor, typename R, typename... Args, typename... Seqs>
+auto dispatch_instance<Functor, R(Args...), Seqs...>::invoke_or_throw(Functor &functor,
+  params_type const &params,
+  Args... args) -> R {
+    return detail::dispatch_inline_impl<true>(functor, params, std::forward<Args>(args)...);
+}
+
+// clang-format off
+// NOLINTBEGIN(cppcoreguidelines-macro-usage)
+/// \brief Declares `dispatch_instance<Functor, R(Args...), Seqs...>` extern.
+///
+/// Place at global namespace scope in a header, after the functor, e.g.
+/// `POET_DECLARE_DISPATCH(Gemm, void(float *, int), Ms, Ns);`. The declaration
+/// changes what matching `dispatch` calls instantiate, so it must be visible
+/// before the first such call in every translation unit. A unit that dispatches
+/// without it builds a different definition of the same inline function (an
+/// ODR violation that is not diagnosed). A unit that dispatches before it fails
+/// to compile with "specialization after instantiation". Declaring it in the
+/// header that defines the functor guarantees both.
+#define POET_DECLARE_DISPATCH(...)                                                                 \
+    template<> struct poet::detail::declared_dispatch<poet::dispatch_instance<__VA_ARGS__>::key_type> { \
+        using type = poet::dispatch_instance<__VA_ARGS__>;                                         \
+    };                                                                                             \
+    extern template struct poet::dispatch_instance<__VA_ARGS__>
+
+/// \brief Instantiates a declared `dispatch_instance`; use once, at global scope, in one source file.
+#define POET_DEFINE_DISPATCH(...) template struct poet::dispatch_instance<__VA_ARGS__>
+// NOLINTEND(cppcoreguidelines-macro-usage)
+// clang-format on
+
 namespace detail {
     template<bool ThrowOnNoMatch, typename Functor, typename TupleList, typename RuntimeTuple, typename... Args>
     auto dispatch_tuples_impl(Functor &&functor,
@@ -788,6 +1649,8 @@ namespace detail {
         using FunctorT = std::decay_t<Functor>;
         FunctorT functor_copy(std::forward<Functor>(functor));
 
+        // Index of the tuple being probed; only read when stats are enabled.
+        [[maybe_unused]] std::size_t probe = 0;
         const bool matched = std::apply(
           [&](auto... seqs) POET_ALWAYS_INLINE_LAMBDA -> bool {
               return ([&](auto &seq) POET_ALWAYS_INLINE_LAMBDA -> bool {
@@ -799,10 +1662,14 @@ namespace detail {
                       out = std::move(result);
                       return true;
                   }
+                  if constexpr (dispatch_stats_enabled) { ++probe; }
                   return false;
               }(seqs) || ...);
           },
           TL{});
+        if constexpr (dispatch_stats_enabled) {
+            record_dispatch<stats_tuple_site<FunctorT, TL>>(matched ? probe : dispatch_npos);
+        }
 
         if (matched) {
             if constexpr (std::is_void_v<result_type>) {
@@ -819,23 +1686,70 @@ namespace detail {
     }
 }// namespace detail
 
+namespace detail {
+    template<typename Layout, typename Values, std::size_t... Ds>
+    POET_FORCEINLINE auto make_axis_params(const Values &values, std::index_sequence<Ds...> /*dims*/) {
+        return std::make_tuple(
+          dispatch_param<std::tuple_element_t<Ds, typename Layout::axes>>{ std::get<Ds>(values) }...);
+    }
+
+    // Result type probed at the first live combination, so a functor that static_asserts on
+    // uncovered combinations is never instantiated there.
+    template<typename Functor, typename SlotMap, typename Axes, typename IdxSeq, typename... Args>
+    struct set_result;
+
+    template<typename Functor, typename SlotMap, typename... Axes, std::size_t... Ds, typename... Args>
+    struct set_result<Functor, SlotMap, std::tuple<Axes...>, std::index_sequence<Ds...>, Args...> {
+        static constexpr std::size_t owner = SlotMap::owners[0];
+        using type = dispatch_result_t<Functor,
+          std::tuple<std::integer_sequence<int,
+            sequence_values<Axes>::value[owner / SlotMap::strides[Ds] % SlotMap::dims[Ds]]>...>,
+          Args...>;
+    };
+
+    template<bool ThrowOnNoMatch, typename Layout, typename Functor, typename RuntimeTuple, typename... Args>
+    POET_FORCEINLINE auto dispatch_set_ranges_impl(Functor &functor, const RuntimeTuple &values, Args &&...args)
+      -> decltype(auto) {
+        using axes = typename Layout::axes;
+        using policy = set_policy<std::decay_t<Functor>, Layout>;
+        constexpr std::size_t rank = std::tuple_size_v<axes>;
+        using result_type = typename set_result<std::decay_t<Functor>,
+          nd_slot_map<policy, axes>,
+          axes,
+          std::make_index_sequence<rank>,
+          Args &&...>::type;
+        const auto params = make_axis_params<Layout>(values, std::make_index_sequence<rank>{});
+        return dispatch_nd<ThrowOnNoMatch, result_type, policy>(functor, params, std::forward<Args>(args)...);
+    }
+
+    template<bool ThrowOnNoMatch, typename Functor, typename ValueType, typename... Tuples, typename... Args>
+    POET_FORCEINLINE auto dispatch_set_impl(Functor &&functor,// NOLINT(cppcoreguidelines-missing-std-forward)
+      const dispatch_set<ValueType, Tuples...> &set,
+      Args &&...args) -> decltype(auto) {
+        using set_t = dispatch_set<ValueType, Tuples...>;
+        if constexpr (set_t::has_ranges) {
+            return dispatch_set_ranges_impl<ThrowOnNoMatch, set_layout<Tuples...>>(
+              functor, set.runtime_tuple(), std::forward<Args>(args)...);
+        } else {
+            return dispatch_tuples_impl<ThrowOnNoMatch>(std::forward<Functor>(functor),
+              typename set_t::seq_type{},
+              set.runtime_tuple(),
+              std::forward<Args>(args)...);
+        }
+    }
+}// namespace detail
+
 /// \brief Dispatches using a `dispatch_set`.
 template<typename Functor, typename... Tuples, typename... Args>
 auto dispatch(Functor &&functor, const dispatch_set<Tuples...> &set, Args &&...args) -> decltype(auto) {
-    return detail::dispatch_tuples_impl<false>(std::forward<Functor>(functor),
-      typename dispatch_set<Tuples...>::seq_type{},
-      set.runtime_tuple(),
-      std::forward<Args>(args)...);
+    return detail::dispatch_set_impl<false>(std::forward<Functor>(functor), set, std::forward<Args>(args)...);
 }
 
 /// \brief Throwing overload for `dispatch_set` dispatch.
 template<typename Functor, typename... Tuples, typename... Args>
 auto dispatch(throw_on_no_match_t /*tag*/, Functor &&functor, const dispatch_set<Tuples...> &set, Args &&...args)
   -> decltype(auto) {
-    return detail::dispatch_tuples_impl<true>(std::forward<Functor>(functor),
-      typename dispatch_set<Tuples...>::seq_type{},
-      set.runtime_tuple(),
-      std::forward<Args>(args)...);
+    return detail::dispatch_set_impl<true>(std::forward<Functor>(functor), set, std::forward<Args>(args)...);
 }
 
 /// \brief Throwing `dispatch_param` overload.
@@ -865,4 +1779,233 @@ auto dispatch(throw_on_no_match_t /*tag*/,
     return detail::dispatch_impl<true>(functor, params, std::forward<Args>(args)...);
 }
 
+namespace detail {
+    template<bool ThrowOnNoMatch, typename Functor, typename Seq, typename... Args>
+    POET_FORCEINLINE auto dispatch_round_up_impl(Functor &functor, dispatch_param<Seq> param, Args &&...args)
+      -> decltype(auto) {
+        using R = dispatch_result_t<Functor, std::tuple<Seq>, int &&, Args &&...>;
+        const int runtime_val = param.runtime_val;
+        const std::size_t idx = seq_lookup<Seq>::find_ceil(runtime_val);
+
+        if (POET_LIKELY(idx != dispatch_npos)) {
+            return invoke_1d_slot<R, Seq>(idx, functor, int{ runtime_val }, std::forward<Args>(args)...);
+        }
+        if constexpr (ThrowOnNoMatch) {
+            throw no_match_error("poet::dispatch_round_up: runtime value exceeds every compile-time candidate");
+        } else if constexpr (!std::is_void_v<R>) {
+            return R{};
+        }
+    }
+}// namespace detail
+
+/// \brief Dispatches to the smallest compiled value `>= param.runtime_val`.
+///
+/// The selected specialization receives the original runtime value as its first
+/// argument so it can mask or pad, e.g. `n = 5` runs `operator()<8>(5, args...)`.
+/// Values above the largest candidate miss like `dispatch`.
+template<typename Functor, typename Seq, typename... Args>
+auto dispatch_round_up(Functor &&functor,// NOLINT(cppcoreguidelines-missing-std-forward) — used by lvalue ref
+  dispatch_param<Seq> param,
+  Args &&...args) -> decltype(auto) {
+    return detail::dispatch_round_up_impl<false>(functor, param, std::forward<Args>(args)...);
+}
+
+/// \brief Throwing overload of `dispatch_round_up`.
+template<typename Functor, typename Seq, typename... Args>
+auto dispatch_round_up(throw_on_no_match_t /*tag*/,
+  Functor &&functor,// NOLINT(cppcoreguidelines-missing-std-forward) — used by lvalue ref
+  dispatch_param<Seq> param,
+  Args &&...args) -> decltype(auto) {
+    return detail::dispatch_round_up_impl<true>(functor, param, std::forward<Args>(args)...);
+}
+
+namespace detail {
+    // Runs one functor against an already computed flat index. Each functor still narrows
+    // through its own `dispatch_valid` map, which costs one small table load.
+    template<bool ThrowOnNoMatch, typename SeqTuple, typename Functor, typename... Args>
+    POET_FORCEINLINE auto invoke_resolved(std::size_t flat, Functor &functor, Args &&...args) -> decltype(auto) {
+        using FunctorT = std::decay_t<Functor>;
+        using R = dispatch_result_t<Functor, SeqTuple, Args &&...>;
+        constexpr std::size_t rank = std::tuple_size_v<SeqTuple>;
+        constexpr bool compressed = uses_compressed_table_v<FunctorT, rank>;
+
+        std::size_t slot = flat;
+        if constexpr (compressed) { slot = nd_slot_map<FunctorT, SeqTuple>::find(flat); }
+        if constexpr (dispatch_stats_enabled) {
+            record_dispatch<stats_product_site<FunctorT, SeqTuple>>(slot == dispatch_npos ? dispatch_npos : flat);
+        }
+        if (POET_LIKELY(slot != dispatch_npos)) {
+            if constexpr (rank == 1 && !compressed) {
+                return invoke_1d_slot<R, std::tuple_element_t<0, SeqTuple>>(slot, functor, std::forward<Args>(args)...);
+            } else {
+                return invoke_nd_slot<R, SeqTuple, FunctorT>(slot, functor, std::forward<Args>(args)...);
+            }
+        }
+        if constexpr (ThrowOnNoMatch) {
+            throw no_match_error("poet::dispatch: no matching compile-time combination for runtime inputs");
+        } else if constexpr (!std::is_void_v<R>) {
+            return R{};
+        }
+    }
+}// namespace detail
+
+/// \brief `dispatch_param` values looked up once, then applied to any number of functors.
+///
+/// Obtain one from `resolve_dispatch`. Calling it with a functor behaves like
+/// `dispatch` with the original parameters but skips the index computation.
+template<typename... Seqs> class resolved_dispatch {
+  public:
+    explicit resolved_dispatch(std::size_t flat) noexcept : flat_(flat) {}
+
+    /// \brief True when the parameters named a compiled combination.
+    [[nodiscard]] auto matched() const noexcept -> bool { return flat_ != detail::dispatch_npos; }
+
+    /// \brief Row-major index of the combination over `Seqs...`; meaningful only when `matched()`.
+    [[nodiscard]] auto index() const noexcept -> std::size_t { return flat_; }
+
+    template<typename Functor,
+      typename... Args,
+      std::enable_if_t<!std::is_same_v<std::decay_t<Functor>, throw_on_no_match_t>, int> = 0>
+    auto operator()(Functor &&functor,// NOLINT(cppcoreguidelines-missing-std-forward) — used by lvalue ref
+      Args &&...args) const -> decltype(auto) {
+        return detail::invoke_resolved<false, std::tuple<Seqs...>>(flat_, functor, std::forward<Args>(args)...);
+    }
+
+    template<typename Functor, typename... Args>
+    auto operator()(throw_on_no_match_t /*tag*/,
+      Functor &&functor,// NOLINT(cppcoreguidelines-missing-std-forward) — used by lvalue ref
+      Args &&...args) const -> decltype(auto) {
+        return detail::invoke_resolved<true, std::tuple<Seqs...>>(flat_, functor, std::forward<Args>(args)...);
+    }
+
+  private:
+    std::size_t flat_;
+};
+
+namespace detail {
+    template<typename SeqTuple> struct resolved_dispatch_for;
+
+    template<typename... Seqs> struct resolved_dispatch_for<std::tuple<Seqs...>> {
+        using type = resolved_dispatch<Seqs...>;
+    };
+}// namespace detail
+
+/// \brief Computes the table index for a tuple of `dispatch_param`s once.
+template<typename ParamTuple, std::enable_if_t<detail::is_dispatch_param_tuple_v<ParamTuple>, int> = 0>
+auto resolve_dispatch(const ParamTuple &params) ->
+  typename detail::resolved_dispatch_for<decltype(detail::extract_sequences<ParamTuple>())>::type {
+    return typename detail::resolved_dispatch_for<decltype(detail::extract_sequences<ParamTuple>())>::type(
+      detail::extract_flat_index(params));
+}
+
+/// \brief Computes the table index for leading `dispatch_param` arguments once.
+template<typename... Params, std::enable_if_t<(detail::is_dispatch_param_v<Params> && ...), int> = 0>
+auto resolve_dispatch(const Params &...params) -> resolved_dispatch<typename std::decay_t<Params>::seq_type...> {
+    return resolve_dispatch(std::make_tuple(params...));
+}
+
+/// \brief Runs every functor with the same `dispatch_param`s, looking them up once.
+///
+/// `params` is a `dispatch_param` or a tuple of them. Functors run in order and
+/// their results are discarded; a miss skips them all.
+template<typename Params, typename... Functors>
+void dispatch_group(const Params &params,
+  Functors &&...functors)// NOLINT(cppcoreguidelines-missing-std-forward) — used by lvalue ref
+{
+    const auto resolved = resolve_dispatch(params);
+    if (!resolved.matched()) { return; }
+    (static_cast<void>(resolved(functors)), ...);
+}
+
+namespace detail {
+    template<int... Sizes> struct decompose_plan {
+        static_assert(sizeof...(Sizes) >= 1, "dispatch_decompose requires at least one size");
+        static_assert(((Sizes > 0) && ...), "dispatch_decompose sizes must be positive");
+
+        using sorted_index = sparse_index<std::integer_sequence<int, Sizes...>>;
+        static constexpr std::size_t count = sorted_index::unique_count;
+
+        // Largest first, so the decomposition is greedy and chunks run in offset order.
+        static constexpr std::array<int, count> sizes = []() constexpr -> std::array<int, count> {
+            std::array<int, count> out{};
+            for (std::size_t i = 0; i < count; ++i) { out[i] = sorted_index::keys[count - 1 - i]; }
+            return out;
+        }();
+
+        // After the chunks above it ran, the remainder is below the previous size, so each
+        // smaller size can fire at most `ceil(prev / size) - 1` times (once on a power-of-two ladder).
+        static constexpr std::array<std::size_t, count> max_repeats =
+          []() constexpr -> std::array<std::size_t, count> {
+            std::array<std::size_t, count> out{};
+            out[0] = 0;
+            for (std::size_t i = 1; i < count; ++i) {
+                const auto prev = static_cast<std::size_t>(sizes[i - 1]);
+                const auto size = static_cast<std::size_t>(sizes[i]);
+                out[i] = ((prev + size - 1) / size) - 1;
+            }
+            return out;
+        }();
+    };
+
+    template<int Size, typename Functor, typename Offset, typename... Args>
+    POET_FORCEINLINE void invoke_decompose_chunk(Functor &functor, Offset offset, Args &...args) {
+        if constexpr (std::is_invocable_v<Functor &, std::integral_constant<int, Size>, Offset, Args &...>) {
+            functor(std::integral_constant<int, Size>{}, offset, args...);
+        } else {
+            functor.template operator()<Size>(offset, args...);
+        }
+    }
+
+    template<int Size, std::size_t MaxRepeats, typename Functor, typename Offset, typename... Args>
+    POET_FORCEINLINE void
+      decompose_step(std::size_t &remaining, Offset &offset, Functor &functor, Args &...args) {
+        constexpr auto usize = static_cast<std::size_t>(Size);
+        if constexpr (MaxRepeats == 1) {
+            if (remaining >= usize) {
+                invoke_decompose_chunk<Size>(functor, offset, args...);
+                offset = static_cast<Offset>(offset + static_cast<Offset>(Size));
+                remaining -= usize;
+            }
+        } else {
+            // MaxRepeats == 0 marks the unbounded leading (largest) size.
+            while (remaining >= usize) {
+                invoke_decompose_chunk<Size>(functor, offset, args...);
+                offset = static_cast<Offset>(offset + static_cast<Offset>(Size));
+                remaining -= usize;
+            }
+        }
+    }
+
+    template<typename Plan, typename Functor, typename Offset, typename... Args, std::size_t... Is>
+    POET_FORCEINLINE auto decompose_impl(std::index_sequence<Is...> /*idxs*/,
+      std::size_t remaining,
+      Functor &functor,
+      Offset offset,
+      Args &...args) -> std::size_t {
+        (decompose_step<Plan::sizes[Is], Plan::max_repeats[Is]>(remaining, offset, functor, args...), ...);
+        return remaining;
+    }
+}// namespace detail
+
+/// \brief Covers a runtime count with compile-time chunk sizes, largest first.
+///
+/// Calls `functor.template operator()<S>(offset, args...)` (or the
+/// `integral_constant` value form) once per chunk, advancing `offset` by `S`;
+/// e.g. `Sizes = 1, 2, 4, 8` turns `n = 13` into chunks `8, 4, 1`. Only
+/// compares against compile-time sizes are emitted — no table lookups.
+///
+/// \return The part of `n` no chunk could cover (always 0 when `1` is a size).
+template<int... Sizes, typename Functor, typename Offset, typename... Args>
+auto dispatch_decompose(std::size_t n,
+  Functor &&functor,// NOLINT(cppcoreguidelines-missing-std-forward) — invoked repeatedly by lvalue ref
+  Offset offset,
+  Args &&...args) -> std::size_t {// NOLINT(cppcoreguidelines-missing-std-forward) — reused for every chunk
+    using plan = detail::decompose_plan<Sizes...>;
+    return detail::decompose_impl<plan>(std::make_index_sequence<plan::count>{}, n, functor, offset, args...);
+}
+
 }// namespace poet
+
+#if defined(POET_DISPATCH_STATS) && POET_DISPATCH_STATS
+#include <poet/core/dispatch_stats.hpp>
+#endif
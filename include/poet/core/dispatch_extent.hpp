@@ -0,0 +1,91 @@
+#pragma once
+
+/// \file dispatch_extent.hpp
+/// \brief Runtime-length spans dispatched to static-extent spans (C++20).
+///
+/// `dispatch_extent<4, 8, 16>(span, kernel, args...)` looks up `span.size()`
+/// with the same `seq_lookup` that backs `dispatch`, and calls
+/// `kernel(std::span<T, N>{...}, args...)` for the matching `N`. A kernel
+/// written for `std::span<T, N>` then sees its length as a constant and can
+/// unroll fully. Other lengths go to the kernel's dynamic-extent overload.
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <poet/core/dispatch.hpp>
+#include <poet/core/macros.hpp>
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+#include <span>
+
+namespace poet {
+
+namespace detail {
+
+    // The functor the 1-D table specializes: rebuilds the span with a static extent.
+    template<typename Functor, typename T> struct extent_body {
+        Functor *functor;
+        T *data;
+
+        template<int N, typename... Args> POET_FORCEINLINE auto operator()(Args &&...args) const -> decltype(auto) {
+            return (*functor)(std::span<T, static_cast<std::size_t>(N)>(data, static_cast<std::size_t>(N)),
+              std::forward<Args>(args)...);
+        }
+    };
+
+    template<bool ThrowOnNoMatch, std::size_t... Sizes, typename T, typename Functor, typename... Args>
+    POET_FORCEINLINE auto dispatch_extent_impl(std::span<T> span, Functor &functor, Args &&...args)
+      -> decltype(auto) {
+        static_assert(sizeof...(Sizes) > 0, "dispatch_extent needs at least one size");
+        static_assert(((Sizes <= static_cast<std::size_t>(std::numeric_limits<int>::max())) && ...),
+          "dispatch_extent sizes must fit in int");
+        using FunctorT = std::remove_reference_t<Functor>;
+        using Seq = std::integer_sequence<int, static_cast<int>(Sizes)...>;
+        using body_t = extent_body<FunctorT, T>;
+        using R = decltype(std::declval<const body_t &>().template operator()<sequence_first<Seq>::value>(
+          std::declval<Args &&>()...));
+
+        const std::size_t size = span.size();
+        const std::size_t idx = size <= static_cast<std::size_t>(std::numeric_limits<int>::max())
+                                  ? seq_lookup<Seq>::find(static_cast<int>(size))
+                                  : dispatch_npos;
+        if (POET_LIKELY(idx != dispatch_npos)) {
+            body_t body{ &functor, span.data() };
+            return invoke_1d_slot<R, Seq>(idx, body, std::forward<Args>(args)...);
+        }
+        if constexpr (ThrowOnNoMatch) {
+            throw no_match_error("poet::dispatch_extent: no static extent for runtime span size");
+        } else if constexpr (std::is_invocable_v<FunctorT &, std::span<T>, Args &&...>) {
+            return static_cast<R>(functor(span, std::forward<Args>(args)...));
+        } else if constexpr (!std::is_void_v<R>) {
+            return R{};
+        }
+    }
+
+}// namespace detail
+
+/// \brief Calls `functor(std::span<T, N>, args...)` for the `N` in `Sizes...` equal to `span.size()`.
+///
+/// Other sizes call `functor(span, args...)` when the functor accepts a
+/// dynamic-extent span, and otherwise return `void` or a default-constructed result.
+template<std::size_t... Sizes, typename T, typename Functor, typename... Args>
+auto dispatch_extent(std::span<T> span,
+  Functor &&functor,// NOLINT(cppcoreguidelines-missing-std-forward) — used by lvalue ref
+  Args &&...args) -> decltype(auto) {
+    return detail::dispatch_extent_impl<false, Sizes...>(span, functor, std::forward<Args>(args)...);
+}
+
+/// \brief `dispatch_extent` overload that throws `no_match_error` for sizes outside `Sizes...`.
+template<std::size_t... Sizes, typename T, typename Functor, typename... Args>
+auto dispatch_extent(throw_on_no_match_t /*tag*/,
+  std::span<T> span,
+  Functor &&functor,// NOLINT(cppcoreguidelines-missing-std-forward) — used by lvalue ref
+  Args &&...args) -> decltype(auto) {
+    return detail::dispatch_extent_impl<true, Sizes...>(span, functor, std::forward<Args>(args)...);
+}
+
+}// namespace poet
+
+#endif// __cplusplus >= 202002L && __has_include(<span>)
@@ -0,0 +1,77 @@
+#pragma once
+
+/// \file dispatch_for.hpp
+/// \brief Loops whose body is specialized once per call instead of once per element.
+///
+/// `dispatch_for<Unroll>(params, begin, end, kernel)` resolves `params` a single
+/// time, and the selected specialization runs the whole `dynamic_for` loop. Every
+/// iteration calls the kernel with compile-time values and a runtime index, so
+/// neither the lookup nor the indirect call repeats inside the loop.
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <poet/core/dispatch.hpp>
+#include <poet/core/dynamic_for.hpp>
+#include <poet/core/macros.hpp>
+
+namespace poet {
+
+namespace detail {
+
+    // The functor `dispatch` specializes: each instantiation owns a complete unrolled loop.
+    template<std::size_t Unroll, typename Kernel, typename T> struct dispatch_for_body {
+        Kernel *kernel;
+        T begin;
+        T end;
+
+        template<int... Vs> POET_FORCEINLINE void operator()() const {
+            // SFINAE-friendly, so dynamic_for picks (lane, index) only if the kernel accepts it.
+            Kernel &k = *kernel;
+            auto step = [&k](auto... loop_args) POET_ALWAYS_INLINE_LAMBDA
+              -> decltype(call_specialized<Vs...>(call_form_rank<1>{}, std::declval<Kernel &>(), loop_args...)) {
+                return call_specialized<Vs...>(call_form_rank<1>{}, k, loop_args...);
+            };
+            dynamic_for<Unroll>(begin, end, step);
+        }
+    };
+
+    template<std::size_t Unroll, typename T1, typename T2, typename Kernel>
+    auto make_dispatch_for_body(T1 begin, T2 end, Kernel &kernel)
+      -> dispatch_for_body<Unroll, Kernel, std::common_type_t<T1, T2>> {
+        using T = std::common_type_t<T1, T2>;
+        return { &kernel, static_cast<T>(begin), static_cast<T>(end) };
+    }
+
+}// namespace detail
+
+/// \brief Resolves `params` once, then runs `[begin, end)` in the matching specialization.
+///
+/// `params` is anything `dispatch` accepts in one argument: a `dispatch_param`, a
+/// tuple of them, or a `dispatch_set`. The kernel is called per index as
+/// `kernel.template operator()<V...>(index)` or `kernel(integral_constant<int, V>{}..., index)`,
+/// optionally with the `dynamic_for` lane before the index. On miss the loop does not run.
+template<std::size_t Unroll, typename Params, typename T1, typename T2, typename Kernel>
+void dispatch_for(const Params &params,
+  T1 begin,
+  T2 end,
+  Kernel &&kernel)// NOLINT(cppcoreguidelines-missing-std-forward) — used by lvalue ref
+{
+    static_assert(Unroll > 0, "dispatch_for requires Unroll > 0");
+    dispatch(detail::make_dispatch_for_body<Unroll>(begin, end, kernel), params);
+}
+
+/// \brief `dispatch_for` overload that throws `no_match_error` on miss.
+template<std::size_t Unroll, typename Params, typename T1, typename T2, typename Kernel>
+void dispatch_for(throw_on_no_match_t /*tag*/,
+  const Params &params,
+  T1 begin,
+  T2 end,
+  Kernel &&kernel)// NOLINT(cppcoreguidelines-missing-std-forward) — used by lvalue ref
+{
+    static_assert(Unroll > 0, "dispatch_for requires Unroll > 0");
+    dispatch(throw_on_no_match, detail::make_dispatch_for_body<Unroll>(begin, end, kernel), params);
+}
+
+}// namespace poet
@@ -0,0 +1,181 @@
+#pragma once
+
+/// \file dispatch_memo.hpp
+/// \brief Dispatch whose results are cached per specialization and runtime arguments.
+///
+/// `dispatch_memo(functor, params, args...)` behaves like `dispatch` for
+/// functors that are pure functions of their compile-time values and `args`,
+/// such as quadrature weights or filter designs. Each result is kept in a
+/// fixed-size process-wide cache keyed by the flat dispatch index and the
+/// arguments, so a repeated request copies the stored result instead of
+/// recomputing it.
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <poet/core/dispatch.hpp>
+#include <poet/core/macros.hpp>
+
+namespace poet {
+
+namespace detail {
+
+    POET_FORCEINLINE constexpr auto memo_mix(std::size_t seed, std::size_t value) noexcept -> std::size_t {
+        return seed ^ (value + static_cast<std::size_t>(0x9e3779b97f4a7c15ULL) + (seed << 6U) + (seed >> 2U));
+    }
+
+    template<typename... Keys> auto memo_hash(std::size_t flat, const Keys &...keys) -> std::size_t {
+        std::size_t seed = memo_mix(0, flat);
+        ((seed = memo_mix(seed, std::hash<Keys>{}(keys))), ...);
+        return seed;
+    }
+
+    template<typename R, typename... Keys> struct memo_entry {
+        std::size_t flat;
+        std::size_t hash;
+        std::tuple<Keys...> keys;
+        R value;
+    };
+
+    // Open-addressed table of immutable entries. A slot is filled once by CAS and never
+    // replaced, so readers need no reclamation scheme. Entries live as long as the process.
+    template<std::size_t Capacity, typename R, typename... Keys> class memo_cache {
+      public:
+        using entry_type = memo_entry<R, Keys...>;
+
+        memo_cache() = default;
+        memo_cache(const memo_cache &) = delete;
+        auto operator=(const memo_cache &) -> memo_cache & = delete;
+
+        [[nodiscard]] auto find(std::size_t flat, std::size_t hash, const Keys &...keys) const -> const entry_type * {
+            for (std::size_t i = 0; i < probe_limit; ++i) {
+                const entry_type *entry = slots_[(hash + i) & (Capacity - 1)].load(std::memory_order_acquire);
+                if (entry == nullptr) { return nullptr; }
+                if (matches(*entry, flat, hash, keys...)) { return entry; }
+            }
+            return nullptr;
+        }
+
+        // Takes ownership of `entry` when a probed slot is free. Otherwise the cache is
+        // full around `hash`, or another thread published the same key first, and the
+        // caller keeps `entry`.
+        void publish(std::unique_ptr<entry_type> &entry) {
+            for (std::size_t i = 0; i < probe_limit; ++i) {
+                auto &slot = slots_[(entry->hash + i) & (Capacity - 1)];
+                const entry_type *expected = nullptr;
+                if (slot.compare_exchange_strong(
+                      expected, entry.get(), std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    static_cast<void>(entry.release());
+                    return;
+                }
+                const auto same_key = [&](const Keys &...keys) {
+                    return matches(*expected, entry->flat, entry->hash, keys...);
+                };
+                if (std::apply(same_key, entry->keys)) { return; }
+            }
+        }
+
+      private:
+        static constexpr std::size_t probe_limit = Capacity < 4 ? Capacity : 4;
+
+        static auto matches(const entry_type &entry, std::size_t flat, std::size_t hash, const Keys &...keys)
+          -> bool {
+            return entry.hash == hash && entry.flat == flat && entry.keys == std::tie(keys...);
+        }
+
+        std::array<std::atomic<const entry_type *>, Capacity> slots_{};
+    };
+
+    // One cache per functor type, sequence set (via `Resolved`), result and argument types.
+    // Leaked on purpose: static destructors and threads still running at exit may dispatch.
+    template<std::size_t Capacity, typename Functor, typename Resolved, typename R, typename... Keys>
+    auto memo_cache_for() -> memo_cache<Capacity, R, Keys...> & {
+        static auto *cache = new memo_cache<Capacity, R, Keys...>();// NOLINT(cppcoreguidelines-owning-memory)
+        return *cache;
+    }
+
+    template<bool ThrowOnNoMatch, std::size_t Capacity, typename Functor, typename Params, typename... Args>
+    auto dispatch_memo_impl(Functor &functor, const Params &params, const Args &...args) {
+        using FunctorT = std::decay_t<Functor>;
+        static_assert(is_stateless_v<FunctorT>,
+          "dispatch_memo caches by functor type, so the functor must be stateless (pass inputs as arguments)");
+        static_assert(
+          Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "dispatch_memo Capacity must be a power of two");
+
+        const auto resolved = resolve_dispatch(params);
+        using resolved_t = std::remove_const_t<decltype(resolved)>;
+        using R = std::decay_t<decltype(std::declval<const resolved_t &>()(functor, args...))>;
+        static_assert(!std::is_void_v<R>, "dispatch_memo needs a result to cache");
+
+        // Misses go through here too, so they return R{} or throw exactly like `dispatch`.
+        auto compute = [&]() -> R {
+            if constexpr (ThrowOnNoMatch) {
+                return resolved(throw_on_no_match, functor, args...);
+            } else {
+                return resolved(functor, args...);
+            }
+        };
+        if (!resolved.matched()) { return compute(); }
+
+        auto &cache = memo_cache_for<Capacity, FunctorT, resolved_t, R, Args...>();
+        using entry_type = typename std::remove_reference_t<decltype(cache)>::entry_type;
+        const std::size_t flat = resolved.index();
+        const std::size_t hash = memo_hash(flat, args...);
+        if (const entry_type *hit = cache.find(flat, hash, args...)) { return hit->value; }
+
+        std::unique_ptr<entry_type> entry(new entry_type{ flat, hash, std::tuple<Args...>(args...), compute() });
+        const entry_type *computed = entry.get();
+        cache.publish(entry);
+        return computed->value;
+    }
+
+    template<typename Params>
+    inline constexpr bool is_memo_params_v = is_dispatch_param_v<Params> || is_dispatch_param_tuple_v<Params>;
+
+}// namespace detail
+
+/// \brief `dispatch` with the result cached by specialization and argument values.
+///
+/// `params` is a `dispatch_param` or a tuple of them. `args` must be hashable
+/// with `std::hash` and equality-comparable; they are passed to the functor as
+/// const lvalues. The functor must be stateless and pure: the cache is keyed by
+/// its type, not its identity, and is shared by every thread in the process.
+///
+/// The cache holds `Capacity` entries. Each key can use one of 4 slots from its
+/// hash, and a slot is never evicted once filled. Keys that find all their slots
+/// taken are recomputed on every call. Keys that never compare equal to
+/// themselves, such as a NaN `double`, are never found again: each such call
+/// fills one more of those slots. Lookups and inserts are lock-free, and the
+/// cache is never freed, so it stays valid during static destruction. A miss
+/// returns `R{}` and is not cached.
+template<std::size_t Capacity = 64,
+  typename Functor,
+  typename Params,
+  typename... Args,
+  std::enable_if_t<detail::is_memo_params_v<Params>, int> = 0>
+auto dispatch_memo(Functor &&functor,// NOLINT(cppcoreguidelines-missing-std-forward) — used by lvalue ref
+  const Params &params,
+  const Args &...args) {
+    return detail::dispatch_memo_impl<false, Capacity>(functor, params, args...);
+}
+
+/// \brief `dispatch_memo` overload that throws `no_match_error` when no specialization matches.
+template<std::size_t Capacity = 64,
+  typename Functor,
+  typename Params,
+  typename... Args,
+  std::enable_if_t<detail::is_memo_params_v<Params>, int> = 0>
+auto dispatch_memo(throw_on_no_match_t /*tag*/,
+  Functor &&functor,// NOLINT(cppcoreguidelines-missing-std-forward) — used by lvalue ref
+  const Params &params,
+  const Args &...args) {
+    return detail::dispatch_memo_impl<true, Capacity>(functor, params, args...);
+}
+
+}// namespace poet
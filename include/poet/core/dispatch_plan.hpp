@@ -0,0 +1,183 @@
+#pragma once
+
+/// \file dispatch_plan.hpp
+/// \brief Pre-resolved sequences of dispatched calls, replayed without lookups.
+///
+/// A `dispatch_plan` records steps of `(functor, dispatch params, bound args)`.
+/// `add` resolves each step to its specialization once and copies the functor
+/// and arguments into an arena block. `run` then walks a flat array of
+/// `(thunk, block)` pairs, so the steady state does no table lookup and builds
+/// no argument tuples.
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <poet/core/dispatch.hpp>
+#include <poet/core/macros.hpp>
+
+namespace poet {
+
+namespace detail {
+
+    // Functor and bound arguments of one step. Arguments are passed as lvalues on
+    // every replay, since the same block is reused.
+    template<typename Functor, typename... Args> struct plan_block {
+        Functor functor;
+        std::tuple<Args...> args;
+
+        template<int... Vs> static void invoke(void *raw) {
+            auto &block = *static_cast<plan_block *>(raw);
+            std::apply(
+              [&block](Args &...bound) POET_ALWAYS_INLINE_LAMBDA {
+                  call_specialized<Vs...>(call_form_rank<1>{}, block.functor, bound...);
+              },
+              block.args);
+        }
+    };
+
+    // Handed to `dispatch` once per step: stores the thunk of the selected specialization.
+    template<typename Block> struct plan_resolver {
+        void (**thunk)(void *);
+
+        template<int... Vs> void operator()() const { *thunk = &Block::template invoke<Vs...>; }
+    };
+
+    // Bump allocator over fixed chunks; blocks never move once placed.
+    class plan_arena {
+      public:
+        auto allocate(std::size_t size, std::size_t align) -> void * {
+            void *ptr = chunks_.empty() ? nullptr : place(size, align);
+            if (ptr == nullptr) {
+                // `size + align - 1` bytes hold the block wherever the chunk starts.
+                const std::size_t capacity = std::max(chunk_size, size + align - 1);
+                chunks_.push_back(std::make_unique<std::byte[]>(capacity));
+                capacity_ = capacity;
+                used_ = 0;
+                ptr = place(size, align);
+            }
+            return ptr;
+        }
+
+      private:
+        // Aligns the next free address of the current chunk; nullptr when the block does not fit.
+        auto place(std::size_t size, std::size_t align) noexcept -> void * {
+            std::byte *base = chunks_.back().get();
+            void *ptr = base + used_;
+            std::size_t space = capacity_ - used_;
+            if (std::align(align, size, ptr, space) == nullptr) { return nullptr; }
+            used_ = static_cast<std::size_t>(static_cast<std::byte *>(ptr) - base) + size;
+            return ptr;
+        }
+
+        static constexpr std::size_t chunk_size = 4096;
+        std::vector<std::unique_ptr<std::byte[]>> chunks_;
+        std::size_t capacity_ = 0;
+        std::size_t used_ = 0;
+    };
+
+}// namespace detail
+
+/// \brief A recorded sequence of specialized calls.
+///
+/// Functors and bound arguments are copied into the plan; results are discarded.
+/// The plan is move-only and must outlive any `run` in progress.
+class dispatch_plan {
+  public:
+    dispatch_plan() = default;
+    dispatch_plan(const dispatch_plan &) = delete;
+    auto operator=(const dispatch_plan &) -> dispatch_plan & = delete;
+    dispatch_plan(dispatch_plan &&other) noexcept
+      : steps_(std::exchange(other.steps_, {})), destructors_(std::exchange(other.destructors_, {})),
+        arena_(std::exchange(other.arena_, {})) {}
+    auto operator=(dispatch_plan &&other) noexcept -> dispatch_plan & {
+        if (this != &other) {
+            destroy_blocks();
+            steps_ = std::exchange(other.steps_, {});
+            destructors_ = std::exchange(other.destructors_, {});
+            arena_ = std::exchange(other.arena_, {});
+        }
+        return *this;
+    }
+    ~dispatch_plan() { destroy_blocks(); }
+
+    /// \brief Appends a step. `params` is anything `dispatch` accepts in one
+    /// argument. Returns false, recording nothing, when no specialization matches.
+    template<typename Functor,
+      typename Params,
+      typename... Args,
+      std::enable_if_t<!std::is_same_v<std::decay_t<Functor>, throw_on_no_match_t>, int> = 0>
+    auto add(Functor &&functor, const Params &params, Args &&...args) -> bool {
+        return add_impl<false>(std::forward<Functor>(functor), params, std::forward<Args>(args)...);
+    }
+
+    /// \brief `add` overload that throws `no_match_error` when no specialization matches.
+    template<typename Functor, typename Params, typename... Args>
+    auto add(throw_on_no_match_t /*tag*/, Functor &&functor, const Params &params, Args &&...args) -> bool {
+        return add_impl<true>(std::forward<Functor>(functor), params, std::forward<Args>(args)...);
+    }
+
+    /// \brief Replays every step in order.
+    void run() const {
+        for (const step &s : steps_) { s.thunk(s.block); }
+    }
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return steps_.size(); }
+    [[nodiscard]] auto empty() const noexcept -> bool { return steps_.empty(); }
+
+  private:
+    struct step {
+        void (*thunk)(void *);
+        void *block;
+    };
+
+    struct destructor {
+        void (*destroy)(void *);
+        void *block;
+    };
+
+    template<bool ThrowOnNoMatch, typename Functor, typename Params, typename... Args>
+    auto add_impl(Functor &&functor, const Params &params, Args &&...args) -> bool {
+        using block_t = detail::plan_block<std::decay_t<Functor>, std::decay_t<Args>...>;
+        void (*thunk)(void *) = nullptr;
+        if constexpr (ThrowOnNoMatch) {
+            dispatch(throw_on_no_match, detail::plan_resolver<block_t>{ &thunk }, params);
+        } else {
+            dispatch(detail::plan_resolver<block_t>{ &thunk }, params);
+            if (thunk == nullptr) { return false; }
+        }
+
+        // Make room first so neither push_back can throw after the block exists.
+        reserve_one_more(steps_);
+        if constexpr (!std::is_trivially_destructible_v<block_t>) { reserve_one_more(destructors_); }
+        void *raw = arena_.allocate(sizeof(block_t), alignof(block_t));
+        auto *block = ::new (raw)
+          block_t{ std::forward<Functor>(functor), std::tuple<std::decay_t<Args>...>(std::forward<Args>(args)...) };
+        steps_.push_back({ thunk, block });
+        if constexpr (!std::is_trivially_destructible_v<block_t>) {
+            destructors_.push_back({ [](void *p) { static_cast<block_t *>(p)->~block_t(); }, block });
+        }
+        return true;
+    }
+
+    // Doubles the capacity when full, so appending stays amortized O(1).
+    template<typename T> static void reserve_one_more(std::vector<T> &v) {
+        if (v.size() == v.capacity()) { v.reserve(std::max<std::size_t>(8, v.capacity() * 2)); }
+    }
+
+    void destroy_blocks() noexcept {
+        for (auto it = destructors_.rbegin(); it != destructors_.rend(); ++it) { it->destroy(it->block); }
+        destructors_.clear();
+    }
+
+    std::vector<step> steps_;
+    std::vector<destructor> destructors_;
+    detail::plan_arena arena_;
+};
+
+}// namespace poet
@@ -0,0 +1,259 @@
+#pragma once
+
+/// \file dispatch_stats.hpp
+/// \brief Opt-in hit/miss counters for dispatch tables.
+///
+/// Define `POET_DISPATCH_STATS=1` (identically in every translation unit) to
+/// make `dispatch` count, per table slot, how often each specialization runs
+/// and how often the lookup misses. Counters are per thread and bumped with
+/// relaxed loads and stores, so the hot path takes no lock and shares no cache
+/// line. Without the macro no counting code is emitted and the snapshot is empty.
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <poet/core/dispatch.hpp>
+#include <poet/core/macros.hpp>
+
+namespace poet {
+
+/// \brief Hits recorded for one specialization.
+struct dispatch_slot_count {
+    std::vector<int> values;///< compile-time values of the specialization
+    std::uint64_t hits = 0;
+};
+
+/// \brief Counters of one dispatch site: a functor type and its candidate values.
+struct dispatch_site_stats {
+    std::string functor;
+    std::vector<dispatch_slot_count> slots;
+    std::uint64_t misses = 0;
+};
+
+namespace detail {
+
+    template<typename T> auto type_name() -> std::string_view {
+#if defined(_MSC_VER) && !defined(__clang__)
+        constexpr std::string_view signature = __FUNCSIG__;
+        constexpr std::string_view prefix = "type_name<";
+        constexpr std::string_view suffix = ">(void)";
+#else
+        constexpr std::string_view signature = __PRETTY_FUNCTION__;
+        constexpr std::string_view prefix = "T = ";
+        constexpr std::string_view suffix = "]";
+#endif
+        const std::size_t begin = signature.find(prefix);
+        if (begin == std::string_view::npos) { return signature; }
+        std::string_view name = signature.substr(begin + prefix.size());
+        // GCC appends "; std::string_view = ..." after the template argument.
+        const std::size_t end = std::min(name.find(';'), name.rfind(suffix));
+        return name.substr(0, end);
+    }
+
+    template<typename Seq> struct sequence_as_ints;
+
+    template<typename T, T... Vs> struct sequence_as_ints<std::integer_sequence<T, Vs...>> {
+        static auto get() -> std::vector<int> { return { static_cast<int>(Vs)... }; }
+    };
+
+    // Slot `i` of an N-D (or 1-D) table is row-major flat index `i` over the product of `Seqs`.
+    template<typename Functor, typename... Seqs> struct stats_product_site<Functor, std::tuple<Seqs...>> {
+        using functor_type = Functor;
+        static constexpr std::size_t rank = sizeof...(Seqs);
+        static constexpr std::size_t slot_count = (sequence_size<Seqs>::value * ... * 1);
+
+        static auto values() -> std::vector<int> {
+            const std::vector<int> axes[] = { sequence_as_ints<Seqs>::get()... };
+            std::vector<int> out;
+            out.reserve(slot_count * rank);
+            for (std::size_t flat = 0; flat < slot_count; ++flat) {
+                std::size_t stride = slot_count;
+                for (const auto &axis : axes) {
+                    stride /= axis.size();
+                    out.push_back(axis[flat / stride % axis.size()]);
+                }
+            }
+            return out;
+        }
+    };
+
+    // Slot `i` of a `dispatch_set` table is its `i`-th allowed tuple.
+    template<typename Functor, typename First, typename... Rest>
+    struct stats_tuple_site<Functor, std::tuple<First, Rest...>> {
+        using functor_type = Functor;
+        static constexpr std::size_t rank = sequence_size<First>::value;
+        static constexpr std::size_t slot_count = 1 + sizeof...(Rest);
+
+        static auto values() -> std::vector<int> {
+            std::vector<int> out;
+            out.reserve(slot_count * rank);
+            for (const auto &tuple : { sequence_as_ints<First>::get(), sequence_as_ints<Rest>::get()... }) {
+                out.insert(out.end(), tuple.begin(), tuple.end());
+            }
+            return out;
+        }
+    };
+
+    struct stats_site {
+        std::string functor;
+        std::size_t rank;
+        std::size_t slot_count;
+        std::vector<int> values;
+        std::mutex mutex;
+        // Counters of running threads, and the totals of threads that have exited.
+        // The last counter of each block is the miss count.
+        std::vector<std::atomic<std::uint64_t> *> live;
+        std::vector<std::uint64_t> retired;
+
+        stats_site(std::string_view name, std::size_t rank_, std::size_t slots, std::vector<int> slot_values)
+          : functor(name), rank(rank_), slot_count(slots), values(std::move(slot_values)), retired(slots + 1, 0) {}
+    };
+
+    struct stats_registry {
+        std::mutex mutex;
+        std::vector<stats_site *> sites;
+    };
+
+    // Leaked on purpose: thread-local blocks may retire during static destruction.
+    inline auto stats_sites() -> stats_registry & {
+        static auto *registry = new stats_registry();// NOLINT(cppcoreguidelines-owning-memory)
+        return *registry;
+    }
+
+    template<typename Site> auto stats_site_of() -> stats_site & {
+        static stats_site *site = [] {
+            auto *created = new stats_site(// NOLINT(cppcoreguidelines-owning-memory)
+              type_name<typename Site::functor_type>(),
+              Site::rank,
+              Site::slot_count,
+              Site::values());
+            auto &registry = stats_sites();
+            const std::lock_guard<std::mutex> lock(registry.mutex);
+            registry.sites.push_back(created);
+            return created;
+        }();
+        return *site;
+    }
+
+    class stats_thread_block {
+      public:
+        explicit stats_thread_block(stats_site &site)
+          : site_(site), counts_(std::make_unique<std::atomic<std::uint64_t>[]>(site.slot_count + 1)) {
+            const std::lock_guard<std::mutex> lock(site_.mutex);
+            site_.live.push_back(counts_.get());
+        }
+
+        stats_thread_block(const stats_thread_block &) = delete;
+        auto operator=(const stats_thread_block &) -> stats_thread_block & = delete;
+
+        ~stats_thread_block() {
+            const std::lock_guard<std::mutex> lock(site_.mutex);
+            for (std::size_t i = 0; i <= site_.slot_count; ++i) {
+                site_.retired[i] += counts_[i].load(std::memory_order_relaxed);
+            }
+            site_.live.erase(std::find(site_.live.begin(), site_.live.end(), counts_.get()));
+        }
+
+        // Single writer per block: a relaxed load + store avoids a locked read-modify-write.
+        POET_FORCEINLINE void bump(std::size_t index) noexcept {
+            auto &counter = counts_[index];
+            counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+
+      private:
+        stats_site &site_;
+        std::unique_ptr<std::atomic<std::uint64_t>[]> counts_;
+    };
+
+    template<typename Site> inline void record_dispatch(std::size_t slot) {
+        thread_local stats_thread_block block(stats_site_of<Site>());
+        block.bump(slot == dispatch_npos ? Site::slot_count : slot);
+    }
+
+}// namespace detail
+
+/// \brief Sums the counters of every dispatch site seen so far, across all threads.
+///
+/// Counts from threads that are still dispatching may be a few increments behind.
+inline auto dispatch_stats_snapshot() -> std::vector<dispatch_site_stats> {
+    auto &registry = detail::stats_sites();
+    const std::lock_guard<std::mutex> registry_lock(registry.mutex);
+    std::vector<dispatch_site_stats> out;
+    out.reserve(registry.sites.size());
+    for (detail::stats_site *site : registry.sites) {
+        const std::lock_guard<std::mutex> lock(site->mutex);
+        std::vector<std::uint64_t> totals = site->retired;
+        for (const auto *counts : site->live) {
+            for (std::size_t i = 0; i <= site->slot_count; ++i) {
+                totals[i] += counts[i].load(std::memory_order_relaxed);
+            }
+        }
+        dispatch_site_stats stats;
+        stats.functor = site->functor;
+        stats.misses = totals[site->slot_count];
+        stats.slots.resize(site->slot_count);
+        for (std::size_t slot = 0; slot < site->slot_count; ++slot) {
+            const auto first = site->values.begin() + static_cast<std::ptrdiff_t>(slot * site->rank);
+            stats.slots[slot].values.assign(first, first + static_cast<std::ptrdiff_t>(site->rank));
+            stats.slots[slot].hits = totals[slot];
+        }
+        out.push_back(std::move(stats));
+    }
+    return out;
+}
+
+/// \brief Zeroes every counter. Increments racing with the reset may survive it.
+inline void dispatch_stats_reset() {
+    auto &registry = detail::stats_sites();
+    const std::lock_guard<std::mutex> registry_lock(registry.mutex);
+    for (detail::stats_site *site : registry.sites) {
+        const std::lock_guard<std::mutex> lock(site->mutex);
+        std::fill(site->retired.begin(), site->retired.end(), 0);
+        for (auto *counts : site->live) {
+            for (std::size_t i = 0; i <= site->slot_count; ++i) { counts[i].store(0, std::memory_order_relaxed); }
+        }
+    }
+}
+
+/// \brief Writes one histogram per site: used specializations by hit count, then misses
+/// and the number of specializations that never ran.
+inline void dispatch_stats_dump(std::ostream &os) {
+    for (auto &site : dispatch_stats_snapshot()) {
+        std::uint64_t total = site.misses;
+        std::uint64_t peak = 0;
+        std::size_t unused = 0;
+        for (const auto &slot : site.slots) {
+            total += slot.hits;
+            peak = std::max(peak, slot.hits);
+            unused += slot.hits == 0 ? 1U : 0U;
+        }
+        os << site.functor << ": " << total << " calls, " << site.misses << " misses, " << unused << " of "
+           << site.slots.size() << " specializations unused\n";
+
+        std::stable_sort(site.slots.begin(), site.slots.end(), [](const auto &a, const auto &b) {
+            return a.hits > b.hits;
+        });
+        constexpr std::uint64_t bar_width = 40;
+        for (const auto &slot : site.slots) {
+            if (slot.hits == 0) { break; }
+            std::string key = "<";
+            for (std::size_t d = 0; d < slot.values.size(); ++d) {
+                key += (d == 0 ? "" : ", ") + std::to_string(slot.values[d]);
+            }
+            key += ">";
+            os << "  " << key << ' ' << slot.hits << ' ' << std::string(slot.hits * bar_width / peak, '#') << '\n';
+        }
+    }
+}
+
+}// namespace poet
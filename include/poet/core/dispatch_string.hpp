@@ -0,0 +1,215 @@
+#pragma once
+
+/// \file dispatch_string.hpp
+/// \brief Runtime-string to compile-time-string dispatch (C++20).
+///
+/// `dispatch_string<"exact", "blocked">(name, Kernel{}, args...)` calls
+/// `Kernel{}.template operator()<"blocked">(args...)` when `name == "blocked"`.
+/// The keys are hashed at compile time with a seed chosen so that no two keys
+/// share a bucket, so a lookup is one hash, one length check and one `memcmp`.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <poet/core/dispatch.hpp>
+#include <poet/core/macros.hpp>
+
+#if __cplusplus >= 202002L
+
+namespace poet {
+
+/// \brief String literal usable as a template argument.
+template<std::size_t N> struct fixed_string {
+    char chars[N]{};// NOLINT(cppcoreguidelines-avoid-c-arrays)
+
+    // NOLINTNEXTLINE(google-explicit-constructor,cppcoreguidelines-avoid-c-arrays)
+    constexpr fixed_string(const char (&str)[N]) noexcept {
+        for (std::size_t i = 0; i < N; ++i) { chars[i] = str[i]; }
+    }
+
+    [[nodiscard]] static constexpr auto size() noexcept -> std::size_t { return N - 1; }
+    [[nodiscard]] constexpr auto view() const noexcept -> std::string_view { return { chars, N - 1 }; }
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    constexpr operator std::string_view() const noexcept { return view(); }
+};
+
+template<std::size_t N>
+fixed_string(const char (&)[N]) -> fixed_string<N>;// NOLINT(cppcoreguidelines-avoid-c-arrays)
+
+/// \brief Value form of a string key, for generic lambdas: `[](auto key) { ... key.value ... }`.
+template<fixed_string Key> struct string_constant {
+    static constexpr auto value = Key;
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    constexpr operator std::string_view() const noexcept { return Key.view(); }
+};
+
+namespace detail {
+
+    // FNV-1a with a seeded basis and a final fold of the high bits into the low ones,
+    // which are the bits the bucket mask keeps.
+    POET_FORCEINLINE constexpr auto string_hash(std::string_view str, std::uint64_t seed) noexcept -> std::uint64_t {
+        std::uint64_t h = 0xcbf29ce484222325ULL ^ seed;
+        for (const char c : str) {
+            h ^= static_cast<unsigned char>(c);
+            h *= 0x100000001b3ULL;
+        }
+        return h ^ (h >> 32U);
+    }
+
+    template<std::size_t Count> struct string_hash_layout {
+        std::uint64_t seed = 0;
+        std::size_t buckets = 0;
+        bool found = false;
+    };
+
+    // Smallest power-of-two bucket count (at least Count, at most 8 * Count) for which
+    // some seed maps every key to its own bucket.
+    template<std::size_t Count>
+    POET_CPP20_CONSTEVAL auto find_string_layout(const std::array<std::string_view, Count> &keys)
+      -> string_hash_layout<Count> {
+        constexpr std::uint64_t max_seeds = 4096;
+        std::size_t buckets = 1;
+        while (buckets < Count) { buckets *= 2; }
+        for (; buckets <= 8 * Count; buckets *= 2) {
+            for (std::uint64_t seed = 0; seed < max_seeds; ++seed) {
+                std::array<bool, 8 * Count> used{};
+                bool ok = true;
+                for (std::size_t i = 0; i < Count && ok; ++i) {
+                    const std::size_t slot = string_hash(keys[i], seed) & (buckets - 1);
+                    ok = !used[slot];
+                    used[slot] = true;
+                }
+                if (ok) { return { seed, buckets, true }; }
+            }
+        }
+        return {};
+    }
+
+    template<std::size_t Count>
+    POET_CPP20_CONSTEVAL auto keys_distinct(const std::array<std::string_view, Count> &keys) -> bool {
+        for (std::size_t i = 0; i < Count; ++i) {
+            for (std::size_t j = i + 1; j < Count; ++j) {
+                if (keys[i] == keys[j]) { return false; }
+            }
+        }
+        return true;
+    }
+
+    /// Perfect-hash index over `Keys`: `find` returns the key's position or `dispatch_npos`.
+    template<fixed_string... Keys> struct string_lookup {
+        static constexpr std::size_t count = sizeof...(Keys);
+        static constexpr std::array<std::string_view, count> keys = { Keys.view()... };
+        static_assert(count > 0, "dispatch_string needs at least one key");
+        static_assert(keys_distinct(keys), "dispatch_string keys must be distinct");
+
+        static constexpr auto layout = find_string_layout(keys);
+        static_assert(layout.found, "dispatch_string: no perfect hash found for these keys");
+        static constexpr std::size_t mask = layout.buckets - 1;
+
+        // Bucket -> key position; empty buckets hold `count`, which never matches.
+        using slot_type = std::conditional_t<(count < 255), std::uint8_t, std::uint16_t>;
+        static constexpr auto buckets = [] {
+            std::array<slot_type, layout.buckets> out{};
+            for (auto &slot : out) { slot = static_cast<slot_type>(count); }
+            for (std::size_t i = 0; i < count; ++i) {
+                out[string_hash(keys[i], layout.seed) & mask] = static_cast<slot_type>(i);
+            }
+            return out;
+        }();
+
+        POET_FORCEINLINE static auto find(std::string_view str) noexcept -> std::size_t {
+            const std::size_t idx = buckets[string_hash(str, layout.seed) & mask];
+            if (idx == count) { return dispatch_npos; }
+            const std::string_view key = keys[idx];
+            // An empty runtime view may have a null data(), which memcmp must not see.
+            if (key.size() != str.size() || (!str.empty() && std::memcmp(key.data(), str.data(), str.size()) != 0)) {
+                return dispatch_npos;
+            }
+            return idx;
+        }
+    };
+
+    template<typename Functor, fixed_string Key, typename... Args> POET_FORCEINLINE auto call_string_key(
+      Functor &func,// NOLINT(cppcoreguidelines-missing-std-forward)
+      Args &&...args) -> decltype(auto) {
+        if constexpr (requires { func.template operator()<Key>(std::forward<Args>(args)...); }) {
+            return func.template operator()<Key>(std::forward<Args>(args)...);
+        } else {
+            return func(string_constant<Key>{}, std::forward<Args>(args)...);
+        }
+    }
+
+    template<typename Functor, typename ArgPack, typename R, fixed_string... Keys> struct string_table_builder;
+
+    template<typename Functor, typename... Args, typename R, fixed_string... Keys>
+    struct string_table_builder<Functor, arg_pack<Args...>, R, Keys...> {
+        template<fixed_string Key> static POET_CPP20_CONSTEVAL auto make_entry() {
+            if constexpr (is_stateless_v<Functor>) {
+                return +[](pass_t<Args &&>... args) -> R {
+                    Functor func{};
+                    return call_string_key<Functor, Key>(func, std::forward<Args>(args)...);
+                };
+            } else {
+                return +[](Functor &func, pass_t<Args &&>... args) -> R {
+                    return call_string_key<Functor, Key>(func, std::forward<Args>(args)...);
+                };
+            }
+        }
+
+        static constexpr std::array table = { make_entry<Keys>()... };
+    };
+
+    template<fixed_string First, fixed_string... Rest> struct first_string_key {
+        static constexpr auto value = First;
+    };
+
+    template<bool ThrowOnNoMatch, fixed_string... Keys, typename Functor, typename... Args>
+    POET_FORCEINLINE auto dispatch_string_impl(std::string_view str, Functor &functor, Args &&...args)
+      -> decltype(auto) {
+        using FunctorT = std::decay_t<Functor>;
+        using R = decltype(call_string_key<FunctorT, first_string_key<Keys...>::value>(
+          std::declval<FunctorT &>(), std::declval<Args &&>()...));
+        using builder = string_table_builder<FunctorT, arg_pack<Args...>, R, Keys...>;
+
+        const std::size_t idx = string_lookup<Keys...>::find(str);
+        if (POET_LIKELY(idx != dispatch_npos)) {
+            return invoke_table_entry<R>(functor, builder::table[idx], std::forward<Args>(args)...);
+        }
+        if constexpr (ThrowOnNoMatch) {
+            throw no_match_error("poet::dispatch_string: no specialization for runtime string");
+        } else if constexpr (!std::is_void_v<R>) {
+            return R{};
+        }
+    }
+
+}// namespace detail
+
+/// \brief Dispatches a runtime string to the specialization for the equal key.
+///
+/// The functor is called as `functor.template operator()<Key>(args...)` or, if
+/// that form is not viable, as `functor(string_constant<Key>{}, args...)`. On
+/// miss returns `void` or a default-constructed result.
+template<fixed_string... Keys, typename Functor, typename... Args>
+auto dispatch_string(std::string_view str,
+  Functor &&functor,// NOLINT(cppcoreguidelines-missing-std-forward) — used by lvalue ref
+  Args &&...args) -> decltype(auto) {
+    return detail::dispatch_string_impl<false, Keys...>(str, functor, std::forward<Args>(args)...);
+}
+
+/// \brief `dispatch_string` overload that throws `no_match_error` on miss.
+template<fixed_string... Keys, typename Functor, typename... Args>
+auto dispatch_string(throw_on_no_match_t /*tag*/,
+  std::string_view str,
+  Functor &&functor,// NOLINT(cppcoreguidelines-missing-std-forward) — used by lvalue ref
+  Args &&...args) -> decltype(auto) {
+    return detail::dispatch_string_impl<true, Keys...>(str, functor, std::forward<Args>(args)...);
+}
+
+}// namespace poet
+
+#endif// __cplusplus >= 202002L
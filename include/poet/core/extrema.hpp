@@ -0,0 +1,174 @@
+#pragma once
+
+/// \file extrema.hpp
+/// \brief Index of the smallest and largest element, with per-lane candidates.
+///
+/// `std::max_element` carries one best value and position through a serial
+/// compare-and-select chain. `argmax<Unroll>`, `argmin<Unroll>` and
+/// `minmax<Unroll>` keep a best value and index per `dynamic_for` lane and
+/// combine the lanes at the end, preferring the lowest index on ties. With
+/// `threads > 1`, large inputs are split into contiguous chunks whose results
+/// are combined in index order, which keeps the same tie-breaking.
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include <poet/core/dynamic_for.hpp>
+#include <poet/core/macros.hpp>
+#include <poet/core/parallel_chunks.hpp>
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+#include <span>
+#endif
+
+namespace poet {
+
+/// \brief An element value and its position.
+template<typename T> struct indexed_value {
+    T value;
+    std::size_t index;
+};
+
+/// \brief The first smallest and first largest element of a range.
+template<typename T> struct minmax_result {
+    indexed_value<T> min;
+    indexed_value<T> max;
+};
+
+namespace detail {
+
+    // Whether `value` strictly beats `best` for the side being tracked.
+    template<bool Max, typename T> POET_FORCEINLINE constexpr auto beats(T value, T best) noexcept -> bool {
+        if constexpr (Max) {
+            return best < value;
+        } else {
+            return value < best;
+        }
+    }
+
+    // Keeps `candidate` if it beats `best`, or ties it at a lower index.
+    template<bool Max, typename T>
+    constexpr void keep_better(indexed_value<T> &best, const indexed_value<T> &candidate) noexcept {
+        if (beats<Max>(candidate.value, best.value)
+            || (!beats<Max>(best.value, candidate.value) && candidate.index < best.index)) {
+            best = candidate;
+        }
+    }
+
+    // One lane's running best per tracked side, stored as parallel arrays so that
+    // a block's lanes sit side by side.
+    template<bool Max, typename T, std::size_t Lanes> struct extremum_lanes {
+        std::array<T, Lanes> value;
+        std::array<std::size_t, Lanes> index{};
+
+        explicit extremum_lanes(T first) noexcept { value.fill(first); }
+
+        // Strict comparison keeps the lane's earliest index on ties. Both selects
+        // are unconditional so the update stays branch-free.
+        template<std::size_t Lane> POET_FORCEINLINE void update(T v, std::size_t i) noexcept {
+            const bool take = beats<Max>(v, value[Lane]);
+            value[Lane] = take ? v : value[Lane];
+            index[Lane] = take ? i : index[Lane];
+        }
+
+        [[nodiscard]] auto merge() const noexcept -> indexed_value<T> {
+            indexed_value<T> best{ value[0], index[0] };
+            for (std::size_t lane = 1; lane < Lanes; ++lane) { keep_better<Max>(best, { value[lane], index[lane] }); }
+            return best;
+        }
+    };
+
+    // Scans `data[0..count)`, count > 0, tracking only the requested sides.
+    template<bool WantMin, bool WantMax, std::size_t Unroll, typename T>
+    auto extrema_serial(const T *data, std::size_t count) noexcept -> minmax_result<T> {
+        extremum_lanes<false, T, Unroll> low(data[0]);
+        extremum_lanes<true, T, Unroll> high(data[0]);
+        dynamic_for<Unroll>(
+          std::size_t{ 1 }, count, [&low, &high, data](auto lane, std::size_t i) POET_ALWAYS_INLINE_LAMBDA {
+              constexpr auto L = decltype(lane)::value;
+              const T v = data[i];
+              if constexpr (WantMin) { low.template update<L>(v, i); }
+              if constexpr (WantMax) { high.template update<L>(v, i); }
+          });
+        return { low.merge(), high.merge() };
+    }
+
+    template<bool WantMin, bool WantMax, std::size_t Unroll, typename T>
+    auto extrema_impl(const T *data, std::size_t count, std::size_t threads) -> minmax_result<T> {
+        static_assert(std::is_arithmetic_v<T>, "argmin/argmax/minmax require an arithmetic element type");
+        static_assert(Unroll > 0, "argmin/argmax/minmax require Unroll > 0");
+        if (count == 0) { return { { T{}, 0 }, { T{}, 0 } }; }
+        const std::size_t chunks = parallel_chunk_count(count, threads);
+        if (chunks == 1) { return extrema_serial<WantMin, WantMax, Unroll>(data, count); }
+
+        std::vector<minmax_result<T>> partial(chunks);
+        auto scan_chunk = [&partial, data](std::size_t chunk, std::size_t begin, std::size_t end) {
+            minmax_result<T> r = extrema_serial<WantMin, WantMax, Unroll>(data + begin, end - begin);
+            r.min.index += begin;
+            r.max.index += begin;
+            partial[chunk] = r;
+        };
+        run_parallel_chunks(count, chunks, scan_chunk);
+
+        // Earlier chunks win ties because `keep_better` only takes a strictly lower index.
+        minmax_result<T> result = partial[0];
+        for (std::size_t chunk = 1; chunk < chunks; ++chunk) {
+            keep_better<false>(result.min, partial[chunk].min);
+            keep_better<true>(result.max, partial[chunk].max);
+        }
+        return result;
+    }
+
+}// namespace detail
+
+/// \brief Index of the first largest element of `data[0..count)`, or 0 when empty.
+///
+/// Compares with `<`, so NaNs never replace a best value but give no defined
+/// answer either. `threads > 1` splits inputs of at least 32Ki elements per
+/// thread across that many threads.
+template<std::size_t Unroll = 4, typename T>
+[[nodiscard]] auto argmax(const T *data, std::size_t count, std::size_t threads = 1) -> std::size_t {
+    return detail::extrema_impl<false, true, Unroll>(data, count, threads).max.index;
+}
+
+/// \brief Index of the first smallest element of `data[0..count)`, or 0 when empty.
+template<std::size_t Unroll = 4, typename T>
+[[nodiscard]] auto argmin(const T *data, std::size_t count, std::size_t threads = 1) -> std::size_t {
+    return detail::extrema_impl<true, false, Unroll>(data, count, threads).min.index;
+}
+
+/// \brief The first smallest and first largest element of `data[0..count)` in one pass.
+///
+/// Unlike `std::minmax_element`, which reports the last largest element, both
+/// sides report the lowest index on ties. An empty range gives value-initialized
+/// values at index 0.
+template<std::size_t Unroll = 4, typename T>
+[[nodiscard]] auto minmax(const T *data, std::size_t count, std::size_t threads = 1) -> minmax_result<T> {
+    return detail::extrema_impl<true, true, Unroll>(data, count, threads);
+}
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+
+/// \brief `argmax` over a span.
+template<std::size_t Unroll = 4, typename T, std::size_t Extent>
+[[nodiscard]] auto argmax(std::span<T, Extent> values, std::size_t threads = 1) -> std::size_t {
+    return argmax<Unroll>(static_cast<const std::remove_cv_t<T> *>(values.data()), values.size(), threads);
+}
+
+/// \brief `argmin` over a span.
+template<std::size_t Unroll = 4, typename T, std::size_t Extent>
+[[nodiscard]] auto argmin(std::span<T, Extent> values, std::size_t threads = 1) -> std::size_t {
+    return argmin<Unroll>(static_cast<const std::remove_cv_t<T> *>(values.data()), values.size(), threads);
+}
+
+/// \brief `minmax` over a span.
+template<std::size_t Unroll = 4, typename T, std::size_t Extent>
+[[nodiscard]] auto minmax(std::span<T, Extent> values, std::size_t threads = 1) -> minmax_result<std::remove_cv_t<T>> {
+    return minmax<Unroll>(static_cast<const std::remove_cv_t<T> *>(values.data()), values.size(), threads);
+}
+
+#endif
+
+}// namespace poet
@@ -0,0 +1,114 @@
+#pragma once
+
+/// \file fused_transform.hpp
+/// \brief Runtime sequences of element-wise ops run as one fused pass.
+///
+/// An op set names its element-wise operations by code:
+///
+/// ```cpp
+/// struct Ops {
+///     static constexpr int op_count = 3;// codes 0, 1, 2
+///     template<int Op, typename T> static constexpr auto apply(T x) -> T { ... }
+/// };
+/// ```
+///
+/// `fused_transform<Ops>(codes, count, in, out, n)` dispatches up to `MaxFused`
+/// codes at a time through an N-D table onto a kernel that applies them all to
+/// each element inside a single `dynamic_for`. No intermediate arrays are
+/// written between the fused ops.
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+#include <poet/core/dispatch.hpp>
+#include <poet/core/dynamic_for.hpp>
+#include <poet/core/macros.hpp>
+
+namespace poet {
+
+namespace detail {
+
+    // Code `OpSet::op_count` pads chains shorter than the table rank and does nothing.
+    template<typename OpSet, int Op, typename T> POET_FORCEINLINE constexpr auto apply_fused_op(T value) -> T {
+        if constexpr (Op == OpSet::op_count) {
+            return value;
+        } else {
+            return OpSet::template apply<Op>(value);
+        }
+    }
+
+    template<typename OpSet, typename T, int... Ops> POET_FORCEINLINE constexpr auto apply_fused(T value) -> T {
+        ((value = apply_fused_op<OpSet, Ops>(value)), ...);
+        return value;
+    }
+
+    template<typename OpSet, std::size_t Unroll, typename T> struct fused_pass {
+        const T *in;
+        T *out;
+        std::size_t n;
+
+        // Padding only at the tail: <a, pad, b> would duplicate <a, b, pad>.
+        template<typename... Codes> static constexpr auto dispatch_valid(Codes... codes) -> bool {
+            bool padded = false;
+            for (const int code : { static_cast<int>(codes)... }) {
+                if (code == OpSet::op_count) {
+                    padded = true;
+                } else if (padded) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template<int... Ops> void operator()() const {
+            const T *src = in;
+            T *dst = out;
+            dynamic_for<Unroll>(std::size_t{ 0 }, n, [src, dst](std::size_t i) POET_ALWAYS_INLINE_LAMBDA {
+                dst[i] = apply_fused<OpSet, T, Ops...>(src[i]);
+            });
+        }
+    };
+
+    template<typename OpSet, std::size_t Unroll, typename T, std::size_t... Slots>
+    void run_fused_pass(const int *codes,
+      std::size_t count,
+      const T *in,
+      T *out,
+      std::size_t n,
+      std::index_sequence<Slots...> /*slots*/) {
+        using code_range = inclusive_range<0, OpSet::op_count>;
+        const auto params =
+          std::make_tuple(dispatch_param<code_range>{ Slots < count ? codes[Slots] : OpSet::op_count }...);
+        dispatch(fused_pass<OpSet, Unroll, T>{ in, out, n }, params);
+    }
+
+}// namespace detail
+
+/// \brief Applies `codes[0..count)` in order to every element of `in`, writing `out`.
+///
+/// Each group of up to `MaxFused` codes runs as one pass over memory; longer
+/// sequences take `ceil(count / MaxFused)` passes, and later passes work in
+/// place on `out`. `in` may equal `out`. Returns false without touching `out`
+/// if any code is outside `[0, OpSet::op_count)`. The table holds one kernel per
+/// chain of at most `MaxFused` codes, so keep `MaxFused` small.
+template<typename OpSet, std::size_t MaxFused = 3, std::size_t Unroll = 4, typename T>
+auto fused_transform(const int *codes, std::size_t count, const T *in, T *out, std::size_t n) -> bool {
+    static_assert(OpSet::op_count > 0, "fused_transform needs at least one op");
+    static_assert(MaxFused > 0, "fused_transform requires MaxFused > 0");
+    for (std::size_t i = 0; i < count; ++i) {
+        if (codes[i] < 0 || codes[i] >= OpSet::op_count) { return false; }
+    }
+
+    const T *src = in;
+    std::size_t done = 0;
+    do {
+        const std::size_t group = count - done < MaxFused ? count - done : MaxFused;
+        detail::run_fused_pass<OpSet, Unroll>(codes + done, group, src, out, n, std::make_index_sequence<MaxFused>{});
+        src = out;
+        done += group;
+    } while (done < count);
+    return true;
+}
+
+}// namespace poet
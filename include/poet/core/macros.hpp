@@ -202,6 +202,42 @@ inline unsigned int poet_count_trailing_zeros(unsigned int value) noexcept {
 #define POET_HOT_LOOP inline
 #endif
 
+// ============================================================================
+// POET_IS_CONSTANT
+// ============================================================================
+/// True when the optimizer has folded `expr` to a constant, typically after
+/// inlining. Always false at -O0 and on compilers without
+/// `__builtin_constant_p`, so it may only select between equivalent code paths.
+#if defined(__GNUC__) || defined(__clang__)
+#define POET_IS_CONSTANT(expr) __builtin_constant_p(expr)// NOLINT(cppcoreguidelines-macro-usage)
+#else
+#define POET_IS_CONSTANT(expr) false// NOLINT(cppcoreguidelines-macro-usage)
+#endif
+
+// ============================================================================
+// POET_MUSTTAIL / POET_HAS_MUSTTAIL
+// ============================================================================
+/// Guarantees a tail call on `return f(args...)` where `f` has the caller's
+/// signature (Clang, GCC >= 15). Expands to nothing elsewhere; check
+/// POET_HAS_MUSTTAIL before relying on it to bound stack depth. Only the
+/// branches that define the attribute set POET_HAS_MUSTTAIL, so a predefined
+/// POET_MUSTTAIL never claims a guarantee the compiler does not give.
+#ifdef __has_cpp_attribute
+#if __has_cpp_attribute(clang::musttail)
+#define POET_MUSTTAIL [[clang::musttail]]// NOLINT(cppcoreguidelines-macro-usage)
+#define POET_HAS_MUSTTAIL 1// NOLINT(cppcoreguidelines-macro-usage)
+#elif __has_cpp_attribute(gnu::musttail)
+#define POET_MUSTTAIL [[gnu::musttail]]// NOLINT(cppcoreguidelines-macro-usage)
+#define POET_HAS_MUSTTAIL 1// NOLINT(cppcoreguidelines-macro-usage)
+#endif
+#endif
+#ifndef POET_HAS_MUSTTAIL
+#ifndef POET_MUSTTAIL
+#define POET_MUSTTAIL
+#endif
+#define POET_HAS_MUSTTAIL 0// NOLINT(cppcoreguidelines-macro-usage)
+#endif
+
 // ============================================================================
 // C++20 Feature Detection
 // ============================================================================
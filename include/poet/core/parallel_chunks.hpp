@@ -0,0 +1,79 @@
+#pragma once
+
+/// \file parallel_chunks.hpp
+/// \brief Splits an index range into contiguous chunks run on short-lived threads.
+///
+/// Used by the reductions and filters that take a `threads` argument. Each
+/// chunk is a contiguous block of indices, and chunk 0 always runs on the
+/// calling thread, so the results of the chunks can be combined in index order.
+
+#include <algorithm>
+#include <cstddef>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace poet::detail {
+
+// Below this many elements per thread, spawning costs more than it saves.
+inline constexpr std::size_t min_parallel_chunk = std::size_t{ 1 } << 15;
+
+// How many chunks `count` elements are split into for up to `threads` workers.
+inline auto parallel_chunk_count(std::size_t count, std::size_t threads) noexcept -> std::size_t {
+    return std::max<std::size_t>(1, std::min(threads, count / min_parallel_chunk));
+}
+
+// First index of chunk `chunk`; the first `count % chunks` chunks get one extra element.
+inline auto parallel_chunk_begin(std::size_t count, std::size_t chunks, std::size_t chunk) noexcept -> std::size_t {
+    return (count / chunks) * chunk + std::min(chunk, count % chunks);
+}
+
+// Joins the workers even if the calling thread's chunk throws.
+class chunk_workers {
+  public:
+    explicit chunk_workers(std::size_t capacity) { threads_.reserve(capacity); }
+    chunk_workers(const chunk_workers &) = delete;
+    auto operator=(const chunk_workers &) -> chunk_workers & = delete;
+    ~chunk_workers() {
+        for (auto &thread : threads_) { thread.join(); }
+    }
+
+    // Starts `func` on a new thread; returns false if the system refuses one.
+    template<typename Func> auto try_start(Func func) -> bool {
+        try {
+            threads_.emplace_back(func);
+            return true;
+        } catch (const std::system_error & /*error*/) { return false; }
+    }
+
+  private:
+    std::vector<std::thread> threads_;
+};
+
+/// Calls `func(chunk, begin, end)` for each of `chunks` contiguous pieces of
+/// `[0, count)`, chunks 1.. on worker threads and chunk 0 on the caller.
+/// Chunks whose thread cannot be started run on the caller afterwards. `func`
+/// must not throw when `chunks > 1`: an exception on a worker terminates.
+template<typename Func> void run_parallel_chunks(std::size_t count, std::size_t chunks, Func &func) {
+    if (chunks <= 1) {
+        func(std::size_t{ 0 }, std::size_t{ 0 }, count);
+        return;
+    }
+    const auto run = [&func, count, chunks](std::size_t chunk) {
+        func(chunk, parallel_chunk_begin(count, chunks, chunk), parallel_chunk_begin(count, chunks, chunk + 1));
+    };
+    std::size_t inline_from = chunks;
+    {
+        chunk_workers workers(chunks - 1);
+        for (std::size_t chunk = 1; chunk < chunks; ++chunk) {
+            if (!workers.try_start([&run, chunk] { run(chunk); })) {
+                inline_from = chunk;
+                break;
+            }
+        }
+        run(0);
+        for (std::size_t chunk = inline_from; chunk < chunks; ++chunk) { run(chunk); }
+    }
+}
+
+}// namespace poet::detail
@@ -0,0 +1,108 @@
+#pragma once
+
+/// \file poly_vector.hpp
+/// \brief Polymorphic container stored as one contiguous segment per type.
+///
+/// `std::vector<std::variant<Ts...>>` pays a type switch on every element.
+/// `poly_vector<Ts...>` keeps a `std::vector<T>` per alternative instead, so
+/// `for_each` dispatches once per segment and runs an unrolled `dynamic_for`
+/// whose body calls `f(T &)` with the type bound at compile time.
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <poet/core/dynamic_for.hpp>
+#include <poet/core/macros.hpp>
+
+namespace poet {
+
+namespace detail {
+
+    template<typename T, typename... Ts>
+    inline constexpr std::size_t type_count_v = (std::size_t{ std::is_same_v<T, Ts> } + ... + 0);
+
+    template<typename... Ts> inline constexpr bool types_unique_v = ((type_count_v<Ts, Ts...> == 1) && ...);
+
+    // Calls `f(elem)` or, if `f` takes a lane first, `f(lane, elem)` on every element of `segment`.
+    template<std::size_t Unroll, typename Segment, typename Func>
+    POET_FORCEINLINE void for_each_in_segment(Segment &segment, Func &func) {
+        using elem_t = decltype(segment[0]);
+        auto *data = segment.data();
+        if constexpr (std::is_invocable_v<Func &, std::integral_constant<std::size_t, 0>, elem_t>) {
+            auto body = [&func, data](auto lane, std::size_t i) POET_ALWAYS_INLINE_LAMBDA { func(lane, data[i]); };
+            dynamic_for<Unroll>(std::size_t{ 0 }, segment.size(), body);
+        } else {
+            static_assert(
+              std::is_invocable_v<Func &, elem_t>, "poly_vector::for_each callable must accept every element type");
+            auto body = [&func, data](std::size_t i) POET_ALWAYS_INLINE_LAMBDA { func(data[i]); };
+            dynamic_for<Unroll>(std::size_t{ 0 }, segment.size(), body);
+        }
+    }
+
+}// namespace detail
+
+/// \brief Stores each of `Ts...` in its own contiguous segment.
+///
+/// Element order is kept within a type but not across types: iteration visits
+/// every `Ts[0]`, then every `Ts[1]`, and so on.
+template<typename... Ts> class poly_vector {
+    static_assert(sizeof...(Ts) > 0, "poly_vector needs at least one type");
+    static_assert(detail::types_unique_v<Ts...>, "poly_vector types must be distinct");
+    static_assert(((std::is_same_v<Ts, std::decay_t<Ts>>) && ...), "poly_vector types must be plain object types");
+    static_assert(detail::type_count_v<bool, Ts...> == 0, "poly_vector cannot hold bool (no vector<bool>::data)");
+
+    template<typename T>
+    static constexpr bool holds_v = detail::type_count_v<std::decay_t<T>, Ts...> == 1;
+
+  public:
+    template<typename T, std::enable_if_t<holds_v<T>, int> = 0> void push_back(T &&value) {
+        segment<std::decay_t<T>>().push_back(std::forward<T>(value));
+    }
+
+    template<typename T, typename... Args> auto emplace_back(Args &&...args) -> T & {
+        static_assert(holds_v<T>, "poly_vector does not hold this type");
+        return segment<T>().emplace_back(std::forward<Args>(args)...);
+    }
+
+    /// \brief The contiguous storage of `T`.
+    template<typename T> [[nodiscard]] auto segment() noexcept -> std::vector<T> & {
+        static_assert(holds_v<T>, "poly_vector does not hold this type");
+        return std::get<std::vector<T>>(segments_);
+    }
+
+    template<typename T> [[nodiscard]] auto segment() const noexcept -> const std::vector<T> & {
+        static_assert(holds_v<T>, "poly_vector does not hold this type");
+        return std::get<std::vector<T>>(segments_);
+    }
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t {
+        return std::apply([](const auto &...segs) { return (segs.size() + ... + 0); }, segments_);
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool { return size() == 0; }
+
+    void clear() noexcept {
+        std::apply([](auto &...segs) { (segs.clear(), ...); }, segments_);
+    }
+
+    /// \brief Calls `func(elem)` (or `func(lane, elem)`) on every element, one
+    /// unrolled `dynamic_for` per type segment.
+    template<std::size_t Unroll = 4, typename Func> void for_each(Func &&func) {
+        static_assert(Unroll > 0, "poly_vector::for_each requires Unroll > 0");
+        std::apply([&func](auto &...segs) { (detail::for_each_in_segment<Unroll>(segs, func), ...); }, segments_);
+    }
+
+    template<std::size_t Unroll = 4, typename Func> void for_each(Func &&func) const {
+        static_assert(Unroll > 0, "poly_vector::for_each requires Unroll > 0");
+        std::apply(
+          [&func](const auto &...segs) { (detail::for_each_in_segment<Unroll>(segs, func), ...); }, segments_);
+    }
+
+  private:
+    std::tuple<std::vector<Ts>...> segments_;
+};
+
+}// namespace poet
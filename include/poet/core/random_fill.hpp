@@ -0,0 +1,236 @@
+#pragma once
+
+/// \file random_fill.hpp
+/// \brief Reproducible parallel random fills from a counter-based generator.
+///
+/// Engines such as `std::mt19937` carry state from one draw to the next, so a
+/// fill runs as one serial chain and its output depends on how the work is
+/// split. `philox4x32` (Salmon et al., "Parallel Random Numbers: As Easy as
+/// 1, 2, 3", SC'11) is instead a pure function of a key and a 128-bit counter.
+/// `random_fill<Unroll>` gives element `i` the block for counter `i`, so the
+/// output is the same for any `Unroll` or thread count. It computes `Unroll`
+/// counters per step, advancing them through the rounds together so that the
+/// independent lanes can share vector registers.
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include <poet/core/macros.hpp>
+#include <poet/core/parallel_chunks.hpp>
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+#include <span>
+#endif
+
+namespace poet {
+
+/// \brief The four 32-bit words produced for one counter.
+using philox_block = std::array<std::uint32_t, 4>;
+
+/// \brief Philox4x32-10: a keyed bijection on 128-bit counters.
+///
+/// Matches the Random123 reference implementation, so its output can be
+/// checked against that library's known-answer vectors.
+class philox4x32 {
+  public:
+    static constexpr int rounds = 10;
+
+    constexpr explicit philox4x32(std::uint64_t seed) noexcept
+      : key_{ static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32U) } {}
+
+    /// \brief The block for `counter`, given as four words, low word first.
+    [[nodiscard]] POET_FORCEINLINE constexpr auto operator()(philox_block counter) const noexcept -> philox_block {
+        std::uint32_t k0 = key_[0];
+        std::uint32_t k1 = key_[1];
+        for (int round = 0; round < rounds; ++round) {
+            const std::uint64_t p0 = std::uint64_t{ mul0 } * counter[0];
+            const std::uint64_t p1 = std::uint64_t{ mul1 } * counter[2];
+            counter = { static_cast<std::uint32_t>(p1 >> 32U) ^ counter[1] ^ k0,
+                static_cast<std::uint32_t>(p1),
+                static_cast<std::uint32_t>(p0 >> 32U) ^ counter[3] ^ k1,
+                static_cast<std::uint32_t>(p0) };
+            k0 += weyl0;
+            k1 += weyl1;
+        }
+        return counter;
+    }
+
+    /// \brief The block for counter `index` in stream `stream`.
+    [[nodiscard]] POET_FORCEINLINE constexpr auto operator()(std::uint64_t index,
+      std::uint64_t stream = 0) const noexcept -> philox_block {
+        return (*this)(philox_block{ static_cast<std::uint32_t>(index),
+          static_cast<std::uint32_t>(index >> 32U),
+          static_cast<std::uint32_t>(stream),
+          static_cast<std::uint32_t>(stream >> 32U) });
+    }
+
+    /// \brief The blocks for counters `first .. first + N` in stream `stream`.
+    ///
+    /// Equal to `N` calls of `operator()`, but the `N` counters advance through
+    /// the rounds together, word by word, so the compiler can put them in one
+    /// vector instead of running `N` separate ten-round chains.
+    template<std::size_t N>
+    [[nodiscard]] POET_FORCEINLINE constexpr auto blocks(std::uint64_t first, std::uint64_t stream = 0) const noexcept
+      -> std::array<philox_block, N> {
+        std::array<std::uint32_t, N> w0{};
+        std::array<std::uint32_t, N> w1{};
+        std::array<std::uint32_t, N> w2{};
+        std::array<std::uint32_t, N> w3{};
+        for (std::size_t l = 0; l < N; ++l) {
+            w0[l] = static_cast<std::uint32_t>(first + l);
+            w1[l] = static_cast<std::uint32_t>((first + l) >> 32U);
+            w2[l] = static_cast<std::uint32_t>(stream);
+            w3[l] = static_cast<std::uint32_t>(stream >> 32U);
+        }
+        std::uint32_t k0 = key_[0];
+        std::uint32_t k1 = key_[1];
+        for (int round = 0; round < rounds; ++round) {
+            for (std::size_t l = 0; l < N; ++l) {
+                const std::uint64_t p0 = std::uint64_t{ mul0 } * w0[l];
+                const std::uint64_t p1 = std::uint64_t{ mul1 } * w2[l];
+                w0[l] = static_cast<std::uint32_t>(p1 >> 32U) ^ w1[l] ^ k0;
+                w1[l] = static_cast<std::uint32_t>(p1);
+                w2[l] = static_cast<std::uint32_t>(p0 >> 32U) ^ w3[l] ^ k1;
+                w3[l] = static_cast<std::uint32_t>(p0);
+            }
+            k0 += weyl0;
+            k1 += weyl1;
+        }
+        std::array<philox_block, N> out{};
+        for (std::size_t l = 0; l < N; ++l) { out[l] = { w0[l], w1[l], w2[l], w3[l] }; }
+        return out;
+    }
+
+  private:
+    static constexpr std::uint32_t mul0 = 0xD2511F53U;
+    static constexpr std::uint32_t mul1 = 0xCD9E8D57U;
+    static constexpr std::uint32_t weyl0 = 0x9E3779B9U;
+    static constexpr std::uint32_t weyl1 = 0xBB67AE85U;
+
+    std::array<std::uint32_t, 2> key_;
+};
+
+namespace detail {
+
+    POET_FORCEINLINE constexpr auto block_bits64(std::uint32_t hi, std::uint32_t lo) noexcept -> std::uint64_t {
+        return (std::uint64_t{ hi } << 32U) | lo;
+    }
+
+    // A value in [0, 1) from the top mantissa-width bits of `bits`.
+    template<typename T> POET_FORCEINLINE constexpr auto unit_interval(std::uint64_t bits) noexcept -> T {
+        constexpr int digits = std::numeric_limits<T>::digits < 64 ? std::numeric_limits<T>::digits : 64;
+        constexpr T scale = T{ 1 } / static_cast<T>(std::uint64_t{ 1 } << (digits - 1)) / T{ 2 };
+        return static_cast<T>(bits >> (64 - digits)) * scale;
+    }
+
+    // High 64 bits of the 128-bit product `a * b`.
+    POET_FORCEINLINE constexpr auto mul_high64(std::uint64_t a, std::uint64_t b) noexcept -> std::uint64_t {
+        const std::uint64_t a_lo = a & 0xFFFFFFFFU;
+        const std::uint64_t a_hi = a >> 32U;
+        const std::uint64_t b_lo = b & 0xFFFFFFFFU;
+        const std::uint64_t b_hi = b >> 32U;
+        const std::uint64_t hi_lo = a_hi * b_lo;
+        const std::uint64_t cross = ((a_lo * b_lo) >> 32U) + (hi_lo & 0xFFFFFFFFU) + a_lo * b_hi;
+        return a_hi * b_hi + (hi_lo >> 32U) + (cross >> 32U);
+    }
+
+    // Fills `data[begin..end)` one block of `Unroll` counters at a time; the
+    // remainder takes one counter per element.
+    template<std::size_t Unroll, typename T, typename Dist>
+    void philox_fill(const philox4x32 &generator, const Dist &dist, T *data, std::size_t begin, std::size_t end) {
+        std::size_t i = begin;
+        for (; end - i >= Unroll; i += Unroll) {
+            const auto blocks = generator.blocks<Unroll>(static_cast<std::uint64_t>(i));
+            for (std::size_t lane = 0; lane < Unroll; ++lane) { data[i + lane] = static_cast<T>(dist(blocks[lane])); }
+        }
+        for (; i < end; ++i) { data[i] = static_cast<T>(dist(generator(static_cast<std::uint64_t>(i)))); }
+    }
+
+}// namespace detail
+
+/// \brief Uniform values in `[lo, hi)` from the first 64 bits of a block.
+///
+/// The top `digits` bits give a multiple of 2^-digits in `[0, 1)`, which is then
+/// scaled; that last step may round up to `hi`.
+template<typename T> struct uniform_real {
+    static_assert(std::is_floating_point_v<T>, "uniform_real requires a floating-point type");
+    T lo = 0;
+    T hi = 1;
+
+    [[nodiscard]] POET_FORCEINLINE constexpr auto operator()(const philox_block &bits) const noexcept -> T {
+        return lo + (hi - lo) * detail::unit_interval<T>(detail::block_bits64(bits[0], bits[1]));
+    }
+};
+
+/// \brief Integers in `[lo, hi]` (inclusive) from the first 64 bits of a block.
+///
+/// Uses a multiply-shift range reduction, whose bias is below 2^-32 for any
+/// range of a 32-bit type.
+template<typename T> struct uniform_int {
+    static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) <= 8,
+      "uniform_int requires an integer type of at most 64 bits");
+    T lo = 0;
+    T hi = std::numeric_limits<T>::max();
+
+    [[nodiscard]] POET_FORCEINLINE constexpr auto operator()(const philox_block &bits) const noexcept -> T {
+        const auto base = static_cast<std::uint64_t>(lo);
+        // Wraps to 0 when [lo, hi] covers all 2^64 values.
+        const std::uint64_t span = static_cast<std::uint64_t>(hi) - base + 1;
+        const std::uint64_t x = detail::block_bits64(bits[0], bits[1]);
+        const std::uint64_t offset = span == 0 ? x : detail::mul_high64(x, span);
+        return static_cast<T>(base + offset);
+    }
+};
+
+/// \brief Normal values with mean `mean` and standard deviation `stddev` (Box-Muller).
+template<typename T> struct normal {
+    static_assert(std::is_floating_point_v<T>, "normal requires a floating-point type");
+    T mean = 0;
+    T stddev = 1;
+
+    [[nodiscard]] POET_FORCEINLINE auto operator()(const philox_block &bits) const noexcept -> T {
+        constexpr T two_pi = static_cast<T>(6.283185307179586476925286766559L);
+        // u1 in (0, 1], so the logarithm stays finite.
+        const T u1 = T{ 1 } - detail::unit_interval<T>(detail::block_bits64(bits[0], bits[1]));
+        const T u2 = detail::unit_interval<T>(detail::block_bits64(bits[2], bits[3]));
+        return mean + stddev * std::sqrt(T{ -2 } * std::log(u1)) * std::cos(two_pi * u2);
+    }
+};
+
+/// \brief Sets `data[i] = dist(philox4x32(seed)(i))` for every `i` in `[0, count)`.
+///
+/// `dist` maps one `philox_block` to a value: `uniform_real`, `uniform_int`,
+/// `normal`, or any callable with that shape. Each element depends only on
+/// `seed` and `i`, so the output does not change with `Unroll` or `threads`.
+/// Every call starts at counter 0 of stream 0; call `philox4x32` directly to
+/// continue a sequence or to draw from another stream.
+///
+/// With `threads > 1`, inputs of at least 32Ki elements per thread are split
+/// across that many threads; `dist` is then called concurrently and must not throw.
+template<std::size_t Unroll = 4, typename T, typename Dist>
+void random_fill(T *data, std::size_t count, std::uint64_t seed, const Dist &dist, std::size_t threads = 1) {
+    static_assert(std::is_invocable_r_v<T, const Dist &, const philox_block &>,
+      "random_fill distribution must map a philox_block to the element type");
+    static_assert(Unroll > 0, "random_fill requires Unroll > 0");
+    const philox4x32 generator(seed);
+    auto fill_chunk = [&dist, generator, data](std::size_t /*chunk*/, std::size_t begin, std::size_t end) {
+        detail::philox_fill<Unroll>(generator, dist, data, begin, end);
+    };
+    detail::run_parallel_chunks(count, detail::parallel_chunk_count(count, threads), fill_chunk);
+}
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+
+/// \brief `random_fill` over a span.
+template<std::size_t Unroll = 4, typename T, std::size_t Extent, typename Dist>
+void random_fill(std::span<T, Extent> data, std::uint64_t seed, const Dist &dist, std::size_t threads = 1) {
+    random_fill<Unroll>(data.data(), data.size(), seed, dist, threads);
+}
+
+#endif
+
+}// namespace poet
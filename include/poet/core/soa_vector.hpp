@@ -0,0 +1,203 @@
+#pragma once
+
+/// \file soa_vector.hpp
+/// \brief Structure-of-arrays container with unrolled, lane-aware iteration.
+///
+/// `soa_vector<Fields...>` keeps each field in its own cache-line-aligned
+/// column, so a kernel that reads two of ten fields streams only those two
+/// arrays. `for_each` drives the columns with `dynamic_for` and passes the
+/// callable a `std::tuple` of references to the fields of one element. That
+/// tuple can be unpacked with structured bindings. `append_aos` and
+/// `copy_to_aos` convert from and to an array of structs, one field at a time.
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <poet/core/cpu_info.hpp>
+#include <poet/core/dynamic_for.hpp>
+#include <poet/core/macros.hpp>
+#include <poet/core/static_for.hpp>
+
+namespace poet {
+
+namespace detail {
+
+    template<typename T, std::size_t Align> struct aligned_allocator {
+        using value_type = T;
+
+        template<typename U> struct rebind {
+            using other = aligned_allocator<U, Align>;
+        };
+
+        aligned_allocator() noexcept = default;
+        // NOLINTNEXTLINE(google-explicit-constructor) — allocators must convert implicitly on rebind
+        template<typename U> aligned_allocator(const aligned_allocator<U, Align> & /*other*/) noexcept {}
+
+        [[nodiscard]] auto allocate(std::size_t n) -> T * {
+            if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) { throw std::bad_array_new_length(); }
+            return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t{ Align }));
+        }
+
+        void deallocate(T *ptr, std::size_t /*n*/) noexcept { ::operator delete(ptr, std::align_val_t{ Align }); }
+
+        friend auto operator==(const aligned_allocator & /*a*/, const aligned_allocator & /*b*/) noexcept -> bool {
+            return true;
+        }
+        friend auto operator!=(const aligned_allocator & /*a*/, const aligned_allocator & /*b*/) noexcept -> bool {
+            return false;
+        }
+    };
+
+    template<typename T>
+    inline constexpr std::size_t column_alignment =
+      alignof(T) > constructive_interference_size() ? alignof(T) : constructive_interference_size();
+
+    template<typename T> using soa_column = std::vector<T, aligned_allocator<T, column_alignment<T>>>;
+
+    // Copy loops of the AoS conversions; each one moves a single field.
+    inline constexpr std::size_t soa_copy_unroll = 4;
+
+    template<std::size_t I, auto... Members>
+    inline constexpr auto nth_member = std::get<I>(std::tuple<decltype(Members)...>{ Members... });
+
+    // Calls `func(refs)` or `func(lane, refs)` for every row, where `refs` ties the
+    // selected columns' elements together.
+    template<std::size_t Unroll, typename Func, typename... Ts>
+    POET_FORCEINLINE void soa_for_each(std::size_t count, Func &func, Ts *...columns) {
+        using ref_t = std::tuple<Ts &...>;
+        if constexpr (std::is_invocable_v<Func &, std::integral_constant<std::size_t, 0>, ref_t>) {
+            auto body = [&func, columns...](auto lane, std::size_t i)
+                          POET_ALWAYS_INLINE_LAMBDA { func(lane, ref_t(columns[i]...)); };
+            dynamic_for<Unroll>(std::size_t{ 0 }, count, body);
+        } else {
+            static_assert(
+              std::is_invocable_v<Func &, ref_t>, "soa_vector::for_each callable must accept a tuple of references");
+            auto body = [&func, columns...](std::size_t i) POET_ALWAYS_INLINE_LAMBDA { func(ref_t(columns[i]...)); };
+            dynamic_for<Unroll>(std::size_t{ 0 }, count, body);
+        }
+    }
+
+}// namespace detail
+
+/// \brief Stores each of `Fields...` in its own contiguous, cache-line-aligned column.
+///
+/// Fields must be nothrow default- and copy-constructible so that every column
+/// always has the same length.
+template<typename... Fields> class soa_vector {
+    static_assert(sizeof...(Fields) > 0, "soa_vector needs at least one field");
+    static_assert(
+      ((std::is_same_v<Fields, std::decay_t<Fields>>) && ...), "soa_vector fields must be plain object types");
+    static_assert(((!std::is_same_v<Fields, bool>) && ...), "soa_vector cannot hold bool (no vector<bool>::data)");
+    static_assert((std::is_nothrow_default_constructible_v<Fields> && ...)
+                    && (std::is_nothrow_copy_constructible_v<Fields> && ...),
+      "soa_vector fields must be nothrow default- and copy-constructible");
+
+  public:
+    static constexpr std::size_t field_count = sizeof...(Fields);
+
+    template<std::size_t I> using field_type = std::tuple_element_t<I, std::tuple<Fields...>>;
+    using reference = std::tuple<Fields &...>;
+    using const_reference = std::tuple<const Fields &...>;
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return std::get<0>(columns_).size(); }
+    [[nodiscard]] auto empty() const noexcept -> bool { return size() == 0; }
+    [[nodiscard]] auto capacity() const noexcept -> std::size_t { return std::get<0>(columns_).capacity(); }
+
+    void reserve(std::size_t count) {
+        std::apply([count](auto &...cols) { (cols.reserve(count), ...); }, columns_);
+    }
+
+    void resize(std::size_t count) {
+        // Reserve every column up front so no column resize can throw, and grow
+        // geometrically so repeated small appends stay amortized O(1).
+        if (count > capacity()) { reserve(std::max(count, 2 * capacity())); }
+        std::apply([count](auto &...cols) { (cols.resize(count), ...); }, columns_);
+    }
+
+    void clear() noexcept {
+        std::apply([](auto &...cols) { (cols.clear(), ...); }, columns_);
+    }
+
+    void push_back(const Fields &...values) {
+        if (size() == capacity()) { reserve(size() == 0 ? 16 : 2 * size()); }
+        std::apply([&values...](auto &...cols) { (cols.push_back(values), ...); }, columns_);
+    }
+
+    [[nodiscard]] auto operator[](std::size_t i) noexcept -> reference {
+        return std::apply([i](auto &...cols) { return reference(cols[i]...); }, columns_);
+    }
+
+    [[nodiscard]] auto operator[](std::size_t i) const noexcept -> const_reference {
+        return std::apply([i](const auto &...cols) { return const_reference(cols[i]...); }, columns_);
+    }
+
+    /// \brief The column of field `I`.
+    template<std::size_t I> [[nodiscard]] auto field() noexcept -> detail::soa_column<field_type<I>> & {
+        return std::get<I>(columns_);
+    }
+
+    template<std::size_t I> [[nodiscard]] auto field() const noexcept -> const detail::soa_column<field_type<I>> & {
+        return std::get<I>(columns_);
+    }
+
+    /// \brief Calls `func(refs)` (or `func(lane, refs)`) on every element in one
+    /// unrolled `dynamic_for`. `refs` holds references to fields `Is...`, or to every
+    /// field when `Is` is empty, so kernels only touch the columns they name.
+    template<std::size_t Unroll = 4, std::size_t... Is, typename Func> void for_each(Func &&func) {
+        static_assert(Unroll > 0, "soa_vector::for_each requires Unroll > 0");
+        for_each_impl<Unroll>(*this, func, selected_fields<Is...>{});
+    }
+
+    template<std::size_t Unroll = 4, std::size_t... Is, typename Func> void for_each(Func &&func) const {
+        static_assert(Unroll > 0, "soa_vector::for_each requires Unroll > 0");
+        for_each_impl<Unroll>(*this, func, selected_fields<Is...>{});
+    }
+
+    /// \brief Appends `count` structs, reading field `I` from `src[k].*Members[I]`.
+    template<auto... Members, typename Struct> void append_aos(const Struct *src, std::size_t count) {
+        static_assert(sizeof...(Members) == field_count, "append_aos needs one member pointer per field");
+        const std::size_t base = size();
+        resize(base + count);
+        static_for<0, static_cast<std::ptrdiff_t>(field_count)>([&](auto field_index) {
+            constexpr auto I = static_cast<std::size_t>(decltype(field_index)::value);
+            constexpr auto member = detail::nth_member<I, Members...>;
+            field_type<I> *dst = std::get<I>(columns_).data() + base;
+            dynamic_for<detail::soa_copy_unroll>(
+              count, [dst, src](std::size_t k) POET_ALWAYS_INLINE_LAMBDA { dst[k] = src[k].*member; });
+        });
+    }
+
+    /// \brief Writes every element to `dst[0..size())`, field `I` into `dst[k].*Members[I]`.
+    template<auto... Members, typename Struct> void copy_to_aos(Struct *dst) const {
+        static_assert(sizeof...(Members) == field_count, "copy_to_aos needs one member pointer per field");
+        const std::size_t count = size();
+        static_for<0, static_cast<std::ptrdiff_t>(field_count)>([&](auto field_index) {
+            constexpr auto I = static_cast<std::size_t>(decltype(field_index)::value);
+            constexpr auto member = detail::nth_member<I, Members...>;
+            const field_type<I> *src = std::get<I>(columns_).data();
+            dynamic_for<detail::soa_copy_unroll>(
+              count, [dst, src](std::size_t k) POET_ALWAYS_INLINE_LAMBDA { dst[k].*member = src[k]; });
+        });
+    }
+
+  private:
+    template<std::size_t... Is>
+    using selected_fields =
+      std::conditional_t<sizeof...(Is) == 0, std::index_sequence_for<Fields...>, std::index_sequence<Is...>>;
+
+    template<std::size_t Unroll, typename Self, typename Func, std::size_t... Is>
+    static void for_each_impl(Self &self, Func &func, std::index_sequence<Is...> /*fields*/) {
+        static_assert(((Is < field_count) && ...), "soa_vector::for_each field index out of range");
+        detail::soa_for_each<Unroll>(self.size(), func, std::get<Is>(self.columns_).data()...);
+    }
+
+    std::tuple<detail::soa_column<Fields>...> columns_;
+};
+
+}// namespace poet
@@ -0,0 +1,83 @@
+#pragma once
+
+/// \file state_machine.hpp
+/// \brief Direct-threaded state machines and interpreters over compile-time states.
+///
+/// A `switch` inside a loop funnels every transition through one indirect branch,
+/// which the predictor can only learn as a whole. `state_machine<States...>`
+/// instead gives each state its own specialized handler, and on compilers with
+/// guaranteed tail calls (`POET_HAS_MUSTTAIL`) each handler jumps straight to the
+/// next one. Every state then ends in its own indirect branch, predicted from
+/// that state's history. Elsewhere the handlers return to a driver loop, which
+/// keeps the stack bounded at the cost of the shared branch.
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <poet/core/dispatch.hpp>
+#include <poet/core/macros.hpp>
+
+namespace poet {
+
+namespace detail {
+
+#if POET_HAS_MUSTTAIL
+    inline constexpr bool threaded_state_machine = true;
+#else
+    inline constexpr bool threaded_state_machine = false;
+#endif
+
+    template<typename Handler, typename Context, int... States> struct state_table {
+        using states = std::integer_sequence<int, States...>;
+        using entry_type = int (*)(Handler &, Context &);
+
+        template<int State> static auto step(Handler &handler, Context &ctx) -> int {
+            const int next = static_cast<int>(call_specialized<State>(call_form_rank<1>{}, handler, ctx));
+            if constexpr (threaded_state_machine) {
+                const std::size_t slot = seq_lookup<states>::find(next);
+                if (POET_UNLIKELY(slot == dispatch_npos)) { return next; }
+                POET_MUSTTAIL return table[slot](handler, ctx);
+            } else {
+                return next;
+            }
+        }
+
+        static constexpr std::array<entry_type, sizeof...(States)> table = { &step<States>... };
+    };
+
+}// namespace detail
+
+/// \brief Runs a handler per state until it returns a value outside `States...`.
+///
+/// The handler is called as `handler.template operator()<State>(ctx)` or
+/// `handler(integral_constant<int, State>{}, ctx)` and returns the next state.
+/// Any value that is not one of `States...` halts the machine and is returned
+/// from `run`, so it doubles as an exit code.
+template<int... States> struct state_machine {
+    static_assert(sizeof...(States) > 0, "state_machine needs at least one state");
+
+    template<typename Handler, typename Context>
+    static auto run(Handler &&handler,// NOLINT(cppcoreguidelines-missing-std-forward) — used by lvalue ref
+      int start,
+      Context &ctx) -> int {
+        using table_t = detail::state_table<std::remove_reference_t<Handler>, Context, States...>;
+        using lookup = detail::seq_lookup<typename table_t::states>;
+
+        std::size_t slot = lookup::find(start);
+        if constexpr (detail::threaded_state_machine) {
+            if (slot == detail::dispatch_npos) { return start; }
+            return table_t::table[slot](handler, ctx);
+        } else {
+            int state = start;
+            while (slot != detail::dispatch_npos) {
+                state = table_t::table[slot](handler, ctx);
+                slot = lookup::find(state);
+            }
+            return state;
+        }
+    }
+};
+
+}// namespace poet
@@ -19,6 +19,8 @@
 /// - POET_HOT_LOOP: Hot path optimization with aggressive inlining
 /// - POET_LIKELY / POET_UNLIKELY: Branch prediction hints
 /// - POET_ASSUME: Compiler assumption hint
+/// - POET_IS_CONSTANT: Optimizer constant-folding probe
+/// - POET_MUSTTAIL / POET_HAS_MUSTTAIL: Guaranteed tail calls
 /// - POET_CPP20_CONSTEVAL: Feature detection
 /// - poet_count_trailing_zeros: (function, not macro — unaffected)
 ///
@@ -112,6 +114,23 @@
 #undef POET_HIGH_OPTIMIZATION
 #endif
 
+// ============================================================================
+// Undefine POET_IS_CONSTANT
+// ============================================================================
+#ifdef POET_IS_CONSTANT
+#undef POET_IS_CONSTANT
+#endif
+
+// ============================================================================
+// Undefine POET_MUSTTAIL / POET_HAS_MUSTTAIL
+// ============================================================================
+#ifdef POET_MUSTTAIL
+#undef POET_MUSTTAIL
+#endif
+#ifdef POET_HAS_MUSTTAIL
+#undef POET_HAS_MUSTTAIL
+#endif
+
 // ============================================================================
 // Undefine C++20/C++23 feature detection macros
 // ============================================================================
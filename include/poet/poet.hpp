@@ -9,8 +9,22 @@
 #include <poet/core/macros.hpp>
 #include <poet/version.hpp>
 #include <poet/core/cpu_info.hpp>
+#include <poet/core/accurate_sum.hpp>
+#include <poet/core/compact.hpp>
+#include <poet/core/crc32c.hpp>
 #include <poet/core/dynamic_for.hpp>
 #include <poet/core/dispatch.hpp>
+#include <poet/core/dispatch_extent.hpp>
+#include <poet/core/dispatch_for.hpp>
+#include <poet/core/dispatch_memo.hpp>
+#include <poet/core/dispatch_plan.hpp>
+#include <poet/core/dispatch_string.hpp>
+#include <poet/core/extrema.hpp>
+#include <poet/core/fused_transform.hpp>
+#include <poet/core/poly_vector.hpp>
+#include <poet/core/random_fill.hpp>
+#include <poet/core/soa_vector.hpp>
+#include <poet/core/state_machine.hpp>
 #include <poet/core/static_for.hpp>
 #include <poet/core/undef_macros.hpp>
 // NOLINTEND(llvm-include-order)
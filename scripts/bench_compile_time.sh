@@ -0,0 +1,60 @@
+#!/usr/bin/env bash
+# bench_compile_time.sh — Compile-time cost of POET_DECLARE_DISPATCH / POET_DEFINE_DISPATCH.
+#
+# Compiles benchmarks/compile_time/user.cpp as POET_COMPILE_BENCH_UNITS separate
+# translation units calling the same 512-entry dispatch, once with every unit
+# instantiating the table (inline) and once with the table declared extern and
+# instantiated by instances.cpp alone. Reports wall time and object size per mode.
+#
+# Usage:
+#   bash scripts/bench_compile_time.sh
+#   CXX=clang++ POET_COMPILE_BENCH_UNITS=16 bash scripts/bench_compile_time.sh
+
+set -euo pipefail
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+PROJECT_ROOT="$(cd "$SCRIPT_DIR/.." && pwd)"
+BENCH_DIR="$PROJECT_ROOT/benchmarks/compile_time"
+
+CXX="${CXX:-c++}"
+UNITS="${POET_COMPILE_BENCH_UNITS:-8}"
+CXXFLAGS=(-std=c++17 -O2 -I"$PROJECT_ROOT/include")
+
+OUT_DIR="$(mktemp -d)"
+trap 'rm -rf "$OUT_DIR"' EXIT
+
+now_ms() { date +%s%3N; }
+
+# compile_mode <extern:0|1> — prints "<ms> <bytes>" for the whole program's objects.
+compile_mode() {
+    local ext="$1" start end
+    local dir="$OUT_DIR/extern$ext"
+    mkdir -p "$dir"
+    start=$(now_ms)
+    for ((unit = 0; unit < UNITS; ++unit)); do
+        "$CXX" "${CXXFLAGS[@]}" -DPOET_COMPILE_BENCH_EXTERN="$ext" -DPOET_COMPILE_BENCH_UNIT="$unit" \
+            -c "$BENCH_DIR/user.cpp" -o "$dir/user$unit.o"
+    done
+    if [[ "$ext" == 1 ]]; then
+        "$CXX" "${CXXFLAGS[@]}" -DPOET_COMPILE_BENCH_EXTERN=1 -c "$BENCH_DIR/instances.cpp" -o "$dir/instances.o"
+    fi
+    end=$(now_ms)
+    echo "$((end - start)) $(cat "$dir"/*.o | wc -c)"
+}
+
+echo "=== POET extern dispatch compile-time benchmark ==="
+echo "Compiler: $("$CXX" --version | head -n 1)"
+echo "Units:    $UNITS"
+echo ""
+
+read -r inline_ms inline_bytes < <(compile_mode 0)
+read -r extern_ms extern_bytes < <(compile_mode 1)
+
+printf "%-28s %10s %14s\n" "mode" "time (ms)" "objects (B)"
+printf "%-28s %10d %14d\n" "inline (every TU)" "$inline_ms" "$inline_bytes"
+printf "%-28s %10d %14d\n" "extern (+ instances.cpp)" "$extern_ms" "$extern_bytes"
+if ((extern_ms > 0)); then
+    echo ""
+    ratio=$((inline_ms * 100 / extern_ms))
+    printf "speedup: %d.%02dx\n" $((ratio / 100)) $((ratio % 100))
+fi
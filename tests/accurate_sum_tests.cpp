@@ -0,0 +1,115 @@
+#include <poet/core/accurate_sum.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+#include <span>
+#endif
+
+namespace {
+// Repeats {big, 1, -big} with a different `big` each time; the exact sum is the
+// number of triples, but a plain running sum loses every 1 next to a big value.
+auto cancelling_triples(std::size_t triples) -> std::vector<double> {
+    std::vector<double> out;
+    for (std::size_t k = 0; k < triples; ++k) {
+        const double big = std::ldexp(1.0 + static_cast<double>(k % 7), 60);
+        out.insert(out.end(), { big, 1.0, -big });
+    }
+    return out;
+}
+
+auto naive_sum(const std::vector<double> &values) -> double {
+    double sum = 0.0;
+    for (double v : values) { sum += v; }
+    return sum;
+}
+}// namespace
+
+TEST_CASE("accurate_sum recovers what a plain sum rounds away", "[accurate_sum]") {
+    const auto values = cancelling_triples(100);
+    REQUIRE(naive_sum(values) != 100.0);
+    REQUIRE(poet::accurate_sum(values.data(), values.size()) == 100.0);
+    REQUIRE(poet::accurate_sum<1>(values.data(), values.size()) == 100.0);
+    REQUIRE(poet::accurate_sum<8>(values.data(), values.size()) == 100.0);
+
+    // Every remainder length, including the empty range.
+    for (std::size_t triples = 0; triples <= 11; ++triples) {
+        const auto part = cancelling_triples(triples);
+        REQUIRE(poet::accurate_sum<4>(part.data(), part.size()) == static_cast<double>(triples));
+    }
+
+    // Past 2^24, adding 1.0F to a float does nothing; the compensation keeps the ones.
+    std::vector<float> floats(1001, 1.0F);
+    floats[0] = 16777216.0F;
+    float plain = 0.0F;
+    for (float v : floats) { plain += v; }
+    REQUIRE(plain == 16777216.0F);
+    REQUIRE(poet::accurate_sum<4>(floats.data(), floats.size()) == 16777216.0F + 1000.0F);
+}
+
+TEST_CASE("accurate_dot keeps the rounding error of each product", "[accurate_sum]") {
+    // x * x == 1 + 2^-29 + 2^-60, and the 2^-60 does not fit in a double next to 1.
+    const double x = 1.0 + std::ldexp(1.0, -30);
+    const double tiny = std::ldexp(1.0, -60);
+    for (std::size_t triples = 0; triples <= 9; ++triples) {
+        std::vector<double> a;
+        std::vector<double> b;
+        for (std::size_t k = 0; k < triples; ++k) {
+            a.insert(a.end(), { x, -1.0, -std::ldexp(1.0, -29) });
+            b.insert(b.end(), { x, 1.0, 1.0 });
+        }
+        REQUIRE(poet::accurate_dot(a.data(), b.data(), a.size()) == static_cast<double>(triples) * tiny);
+        REQUIRE(poet::accurate_dot<1>(a.data(), b.data(), a.size()) == static_cast<double>(triples) * tiny);
+    }
+
+    const std::vector<float> ones(37, 1.0F);
+    std::vector<float> ramp(37);
+    for (std::size_t i = 0; i < ramp.size(); ++i) { ramp[i] = static_cast<float>(i); }
+    REQUIRE(poet::accurate_dot<8>(ones.data(), ramp.data(), ones.size()) == 666.0F);
+}
+
+TEST_CASE("accurate_sum and accurate_dot keep infinities and NaNs", "[accurate_sum]") {
+    const double inf = std::numeric_limits<double>::infinity();
+    const std::vector<double> with_inf{ inf, 1.0, 2.0 };
+    REQUIRE(poet::accurate_sum<1>(with_inf.data(), with_inf.size()) == inf);
+    REQUIRE(poet::accurate_sum<4>(with_inf.data(), with_inf.size()) == inf);
+
+    // Finite inputs whose sum overflows.
+    const std::vector<double> huge{ 1e308, 1e308, -1.0 };
+    REQUIRE(poet::accurate_sum<1>(huge.data(), huge.size()) == inf);
+    REQUIRE(poet::accurate_sum<2>(huge.data(), huge.size()) == inf);
+    const std::vector<double> negative_huge{ -1e308, -1e308 };
+    REQUIRE(poet::accurate_sum<1>(negative_huge.data(), negative_huge.size()) == -inf);
+
+    const std::vector<double> opposite{ inf, -inf };
+    REQUIRE(std::isnan(poet::accurate_sum<1>(opposite.data(), opposite.size())));
+    const std::vector<double> with_nan{ 1.0, std::numeric_limits<double>::quiet_NaN() };
+    REQUIRE(std::isnan(poet::accurate_sum(with_nan.data(), with_nan.size())));
+
+    const std::vector<double> a{ inf, 1.0, 2.0 };
+    const std::vector<double> b{ 2.0, 1.0, 1.0 };
+    REQUIRE(poet::accurate_dot<1>(a.data(), b.data(), a.size()) == inf);
+    REQUIRE(poet::accurate_dot(a.data(), b.data(), a.size()) == inf);
+    // Each product overflows.
+    const std::vector<double> big{ 1e200, -1e200 };
+    REQUIRE(poet::accurate_dot<1>(big.data(), big.data(), 1) == inf);
+    REQUIRE(poet::accurate_dot<1>(big.data() + 1, big.data(), 1) == -inf);
+}
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+TEST_CASE("accurate_sum and accurate_dot accept spans", "[accurate_sum]") {
+    const auto values = cancelling_triples(20);
+    REQUIRE(poet::accurate_sum(std::span<const double>(values)) == 20.0);
+
+    std::vector<double> a{ 1.0, 2.0, 3.0, 4.0 };
+    const std::vector<double> b{ 4.0, 3.0, 2.0 };
+    REQUIRE(poet::accurate_sum<2>(std::span(a)) == 10.0);
+    // The shorter span sets the length.
+    REQUIRE(poet::accurate_dot(std::span(a), std::span(b)) == 16.0);
+}
+#endif
@@ -0,0 +1,42 @@
+# Compiles SOURCE to assembly and checks which symbols the output references.
+#
+#   cmake -DCOMPILER=<c++> -DINCLUDE_DIR=<dir> -DSOURCE=<file.cpp> -DOUTPUT=<file.s>
+#         [-DFLAGS=<;-list>] [-DFORBID=<regex>] [-DREQUIRE=<regex>] -P check_asm_symbols.cmake
+#
+# Fails when FORBID matches a line that uses a symbol, or REQUIRE matches none.
+# Only instructions and data count: compilers may still emit the bodies of
+# functions nothing calls, so labels and .type/.size/.globl lines are skipped.
+# Symbols are checked in their mangled form, so the patterns do not depend on
+# the target ISA.
+
+foreach(_var COMPILER INCLUDE_DIR SOURCE OUTPUT)
+  if(NOT DEFINED ${_var})
+    message(FATAL_ERROR "check_asm_symbols: ${_var} is required")
+  endif()
+endforeach()
+
+execute_process(
+  COMMAND ${COMPILER} -std=c++17 -O2 -S ${FLAGS} -I${INCLUDE_DIR} ${SOURCE} -o ${OUTPUT}
+  RESULT_VARIABLE _result
+  ERROR_VARIABLE _errors)
+if(NOT _result EQUAL 0)
+  message(FATAL_ERROR "check_asm_symbols: compiling ${SOURCE} failed:\n${_errors}")
+endif()
+
+file(STRINGS ${OUTPUT} _lines)
+set(_required FALSE)
+foreach(_line IN LISTS _lines)
+  if(_line MATCHES "^[^ \t].*:$" OR _line MATCHES "^[ \t]*\\.(type|size|globl|weak|local|hidden|set)[ \t]")
+    continue()
+  endif()
+  if(DEFINED FORBID AND _line MATCHES "${FORBID}")
+    message(FATAL_ERROR "check_asm_symbols: ${OUTPUT} uses a forbidden symbol:\n${_line}")
+  endif()
+  if(DEFINED REQUIRE AND _line MATCHES "${REQUIRE}")
+    set(_required TRUE)
+  endif()
+endforeach()
+
+if(DEFINED REQUIRE AND NOT _required)
+  message(FATAL_ERROR "check_asm_symbols: no instruction or data in ${OUTPUT} matches '${REQUIRE}'")
+endif()
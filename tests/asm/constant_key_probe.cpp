@@ -0,0 +1,64 @@
+// Compiled to assembly by check_asm_symbols.cmake, never linked. Every dispatch
+// below has a literal key, so the constant-key fast path must leave no dispatch
+// table or table entry in the output. With POET_PROBE_RUNTIME_KEYS the keys are
+// read from globals instead; that build must still use the tables, which shows
+// the check can see them.
+
+#include <poet/core/dispatch.hpp>
+
+#include <tuple>
+
+#ifdef POET_PROBE_RUNTIME_KEYS
+extern int probe_n;
+extern int probe_s;
+#define POET_PROBE_N probe_n
+#define POET_PROBE_S probe_s
+#else
+#define POET_PROBE_N 5
+#define POET_PROBE_S 2
+#endif
+
+namespace {
+
+using sizes = poet::inclusive_range<1, 16>;
+// 16 x 4 = 64 slots: the largest product that still gets the constant-key switch.
+using shifts = poet::inclusive_range<0, 3>;
+
+struct scale {
+    template<int N> auto operator()(int x) const -> int { return x * N + 7; }
+};
+
+struct scale_shift {
+    template<int N, int S> auto operator()(int x) const -> int { return (x * N) >> S; }
+};
+
+struct scale_shift_valid {
+    template<int N, int S> auto operator()(int x) const -> int { return (x * N) >> S; }
+    static constexpr auto dispatch_valid(int n, int s) -> bool { return s < n; }
+};
+
+}// namespace
+
+auto probe_1d(int x) -> int { return poet::dispatch(scale{}, poet::dispatch_param<sizes>{ POET_PROBE_N }, x); }
+
+auto probe_2d(int x) -> int {
+    return poet::dispatch(
+      scale_shift{}, poet::dispatch_param<sizes>{ POET_PROBE_N }, poet::dispatch_param<shifts>{ POET_PROBE_S }, x);
+}
+
+auto probe_2d_tuple(int x) -> int {
+    const auto params =
+      std::make_tuple(poet::dispatch_param<sizes>{ POET_PROBE_N }, poet::dispatch_param<shifts>{ POET_PROBE_S });
+    return poet::dispatch(scale_shift{}, params, x);
+}
+
+auto probe_2d_valid(int x) -> int {
+    return poet::dispatch(scale_shift_valid{},
+      poet::dispatch_param<sizes>{ POET_PROBE_N },
+      poet::dispatch_param<shifts>{ POET_PROBE_S },
+      x);
+}
+
+auto probe_throwing(int x) -> int {
+    return poet::dispatch(poet::throw_on_no_match, scale{}, poet::dispatch_param<sizes>{ POET_PROBE_N }, x);
+}
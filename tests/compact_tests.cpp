@@ -0,0 +1,100 @@
+#include <poet/core/compact.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+#include <span>
+#endif
+
+namespace {
+auto pseudo_random(std::size_t n, std::uint32_t seed) -> std::vector<std::uint32_t> {
+    std::vector<std::uint32_t> out(n);
+    std::uint32_t x = seed;
+    for (auto &v : out) {
+        x = x * 1664525U + 1013904223U;
+        v = x >> 8U;
+    }
+    return out;
+}
+
+auto reference(const std::vector<std::uint32_t> &in, bool (*pred)(std::uint32_t)) -> std::vector<std::uint32_t> {
+    std::vector<std::uint32_t> out;
+    std::copy_if(in.begin(), in.end(), std::back_inserter(out), pred);
+    return out;
+}
+
+auto is_odd(std::uint32_t v) -> bool { return (v & 1U) != 0; }
+auto is_rare(std::uint32_t v) -> bool { return v % 97U == 0; }
+}// namespace
+
+TEST_CASE("compact keeps survivors in order", "[compact]") {
+    for (std::size_t n = 0; n <= 40; ++n) {
+        const auto in = pseudo_random(n, static_cast<std::uint32_t>(n + 1));
+        const auto expected = reference(in, is_odd);
+        std::vector<std::uint32_t> out(n);
+        REQUIRE(poet::compact(in.data(), n, out.data(), is_odd) == expected.size());
+        REQUIRE(std::equal(expected.begin(), expected.end(), out.begin()));
+        REQUIRE(poet::compact<1>(in.data(), n, out.data(), is_odd) == expected.size());
+        REQUIRE(std::equal(expected.begin(), expected.end(), out.begin()));
+        REQUIRE(poet::compact<8>(in.data(), n, out.data(), is_odd) == expected.size());
+        REQUIRE(std::equal(expected.begin(), expected.end(), out.begin()));
+    }
+
+    const std::vector<double> values{ 1.5, -2.0, 3.0, -4.5, 5.0, 0.0, -1.0 };
+    std::vector<double> positive(values.size());
+    const auto kept = poet::compact<4>(values.data(), values.size(), positive.data(), [](double v) { return v > 0.0; });
+    REQUIRE(kept == 3);
+    REQUIRE(positive[0] == 1.5);
+    REQUIRE(positive[1] == 3.0);
+    REQUIRE(positive[2] == 5.0);
+}
+
+TEST_CASE("compact filters in place", "[compact]") {
+    auto data = pseudo_random(103, 5);
+    const auto expected = reference(data, is_odd);
+    const auto kept = poet::compact<4>(data.data(), data.size(), data.data(), is_odd);
+    REQUIRE(kept == expected.size());
+    REQUIRE(std::equal(expected.begin(), expected.end(), data.begin()));
+
+    // In-place requests for several threads fall back to the calling thread.
+    auto big = pseudo_random(4 * poet::detail::min_parallel_chunk + 7, 6);
+    const auto big_expected = reference(big, is_rare);
+    REQUIRE(poet::compact(big.data(), big.size(), big.data(), is_rare, 4) == big_expected.size());
+    REQUIRE(std::equal(big_expected.begin(), big_expected.end(), big.begin()));
+}
+
+TEST_CASE("compact splits large inputs across threads", "[compact]") {
+    const std::size_t n = 4 * poet::detail::min_parallel_chunk + 1001;
+    const auto in = pseudo_random(n, 11);
+    for (auto pred : { is_odd, is_rare }) {
+        const auto expected = reference(in, pred);
+        // Sized exactly: the threaded path never stores past the survivors.
+        std::vector<std::uint32_t> out(expected.size());
+        REQUIRE(poet::compact<8>(in.data(), n, out.data(), pred, 4) == expected.size());
+        REQUIRE(out == expected);
+    }
+
+    // A chunk with no survivors contributes nothing.
+    std::vector<std::uint32_t> sparse(n, 0);
+    sparse[10] = 1;
+    sparse[n - 1] = 3;
+    std::vector<std::uint32_t> out(2);
+    REQUIRE(poet::compact(sparse.data(), n, out.data(), is_odd, 3) == 2);
+    REQUIRE(out == std::vector<std::uint32_t>{ 1, 3 });
+}
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+TEST_CASE("compact accepts a span", "[compact]") {
+    const auto in = pseudo_random(29, 3);
+    const auto expected = reference(in, is_odd);
+    std::vector<std::uint32_t> out(in.size());
+    REQUIRE(poet::compact(std::span(in), out.data(), is_odd) == expected.size());
+    REQUIRE(std::equal(expected.begin(), expected.end(), out.begin()));
+}
+#endif
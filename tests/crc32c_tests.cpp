@@ -0,0 +1,85 @@
+#include <poet/core/crc32c.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+#include <span>
+#endif
+
+namespace {
+// Bit-at-a-time reference.
+auto reference_crc32c(const std::vector<unsigned char> &bytes) -> std::uint32_t {
+    std::uint32_t crc = 0xFFFFFFFFU;
+    for (unsigned char b : bytes) {
+        crc ^= b;
+        for (int bit = 0; bit < 8; ++bit) { crc = (crc & 1U) != 0 ? (crc >> 1U) ^ 0x82F63B78U : crc >> 1U; }
+    }
+    return ~crc;
+}
+
+auto pseudo_random_bytes(std::size_t n) -> std::vector<unsigned char> {
+    std::vector<unsigned char> out(n);
+    std::uint32_t x = 12345;
+    for (auto &b : out) {
+        x = x * 1664525U + 1013904223U;
+        b = static_cast<unsigned char>(x >> 24U);
+    }
+    return out;
+}
+}// namespace
+
+TEST_CASE("crc32c matches the published check values", "[crc32c]") {
+    REQUIRE(poet::crc32c("123456789", 9) == 0xE3069283U);
+    REQUIRE(poet::crc32c("", 0) == 0U);
+
+    // RFC 3720, appendix B.4.
+    std::array<unsigned char, 32> bytes{};
+    REQUIRE(poet::crc32c(bytes.data(), bytes.size()) == 0x8A9136AAU);
+    bytes.fill(0xFF);
+    REQUIRE(poet::crc32c(bytes.data(), bytes.size()) == 0x62A8AB43U);
+    for (std::size_t i = 0; i < bytes.size(); ++i) { bytes[i] = static_cast<unsigned char>(i); }
+    REQUIRE(poet::crc32c(bytes.data(), bytes.size()) == 0x46DD794EU);
+}
+
+TEST_CASE("crc32c gives the same result for every stream count", "[crc32c]") {
+    const auto data = pseudo_random_bytes(9 * poet::detail::crc32c_stream_bytes + 13);
+    // Sizes around the chunk boundaries of Unroll = 2, 3 and 4.
+    for (std::size_t size : { std::size_t{ 0 }, std::size_t{ 7 }, std::size_t{ 1023 }, std::size_t{ 1024 },
+           std::size_t{ 1031 }, std::size_t{ 1536 }, std::size_t{ 2047 }, std::size_t{ 2048 }, data.size() }) {
+        const std::vector<unsigned char> prefix(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(size));
+        const auto expected = reference_crc32c(prefix);
+        REQUIRE(poet::crc32c<1>(data.data(), size) == expected);
+        REQUIRE(poet::crc32c<2>(data.data(), size) == expected);
+        REQUIRE(poet::crc32c<3>(data.data(), size) == expected);
+        REQUIRE(poet::crc32c(data.data(), size) == expected);
+        REQUIRE(poet::crc32c<8>(data.data(), size) == expected);
+    }
+}
+
+TEST_CASE("crc32c continues from a previous checksum", "[crc32c]") {
+    const auto data = pseudo_random_bytes(5000);
+    const auto whole = poet::crc32c<4>(data.data(), data.size());
+    for (std::size_t split : { std::size_t{ 0 }, std::size_t{ 1 }, std::size_t{ 1537 }, std::size_t{ 4999 } }) {
+        const auto head = poet::crc32c<4>(data.data(), split);
+        REQUIRE(poet::crc32c<4>(data.data() + split, data.size() - split, head) == whole);
+    }
+
+    // Folding a stream by shifting matches running through zero bytes.
+    const std::vector<unsigned char> zeros(poet::detail::crc32c_stream_bytes, 0);
+    const std::uint32_t reg = 0xDEADBEEFU;
+    REQUIRE(poet::detail::crc32c_shift(poet::detail::crc32c_stream_shift, reg)
+            == poet::detail::crc32c_raw<1>(reg, zeros.data(), zeros.size()));
+}
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+TEST_CASE("crc32c accepts a byte span", "[crc32c]") {
+    const std::vector<std::uint32_t> words{ 1, 2, 3, 4, 5 };
+    const auto bytes = std::as_bytes(std::span(words));
+    REQUIRE(poet::crc32c(bytes) == poet::crc32c(words.data(), words.size() * sizeof(std::uint32_t)));
+}
+#endif
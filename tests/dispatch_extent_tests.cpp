@@ -0,0 +1,67 @@
+#include <poet/core/dispatch_extent.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#if __cplusplus >= 202002L
+
+#include <array>
+#include <cstddef>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+using poet::dispatch_extent;
+
+// Reports the extent it was instantiated for; dynamic spans report -1.
+struct extent_probe {
+    template<std::size_t N> auto operator()(std::span<const int, N> s, int scale) const -> long {
+        long sum = 0;
+        for (const int v : s) { sum += v; }
+        return N == std::dynamic_extent ? -sum * scale : sum * scale + 1000L * static_cast<long>(N);
+    }
+};
+
+struct static_only {
+    int *calls;
+    template<std::size_t N>
+        requires(N != std::dynamic_extent)
+    void operator()(std::span<float, N> s) const {
+        for (auto &v : s) { v *= 2.0F; }
+        ++*calls;
+    }
+};
+}// namespace
+
+TEST_CASE("dispatch_extent passes static extents for compiled sizes", "[static_dispatch][extent]") {
+    std::vector<int> data(16);
+    std::iota(data.begin(), data.end(), 1);
+    const std::span<const int> all(data);
+    REQUIRE(dispatch_extent<4, 8, 16>(all.first(4), extent_probe{}, 1) == 10 + 4000);
+    REQUIRE(dispatch_extent<4, 8, 16>(all.first(8), extent_probe{}, 2) == 72 + 8000);
+    REQUIRE(dispatch_extent<4, 8, 16>(all, extent_probe{}, 1) == 136 + 16000);
+}
+
+TEST_CASE("dispatch_extent falls back to the dynamic-extent overload", "[static_dispatch][extent]") {
+    std::array<int, 5> data = { 1, 2, 3, 4, 5 };
+    const std::span<const int> s(data);
+    REQUIRE(dispatch_extent<4, 8>(s, extent_probe{}, 3) == -45);
+    REQUIRE(dispatch_extent<4, 8>(s.first(0), extent_probe{}, 3) == 0);
+    auto strict = [&] { return dispatch_extent<4, 8>(poet::throw_on_no_match, s, extent_probe{}, 1); };
+    REQUIRE_THROWS_AS(strict(), poet::no_match_error);
+}
+
+TEST_CASE("dispatch_extent skips kernels without a dynamic overload on miss", "[static_dispatch][extent]") {
+    std::vector<float> data(3, 1.0F);
+    int calls = 0;
+    dispatch_extent<1, 2, 3>(std::span<float>(data), static_only{ &calls });
+    REQUIRE(calls == 1);
+    REQUIRE(data == std::vector<float>(3, 2.0F));
+
+    dispatch_extent<1, 2>(std::span<float>(data), static_only{ &calls });
+    REQUIRE(calls == 1);
+    REQUIRE(data == std::vector<float>(3, 2.0F));
+}
+
+#endif// __cplusplus >= 202002L
@@ -0,0 +1,7 @@
+// The single translation unit that instantiates the tables declared in dispatch_extern_kernels.hpp.
+#include "dispatch_extern_kernels.hpp"
+
+POET_DEFINE_DISPATCH(extern_test::tile_area, int(int), extern_test::Rows, extern_test::Cols);
+POET_DEFINE_DISPATCH(extern_test::tally, void(int), extern_test::Rows);
+POET_DEFINE_DISPATCH(extern_test::scaled_area, int(int), extern_test::Rows, extern_test::Cols);
+POET_DEFINE_DISPATCH(extern_test::boxer, std::unique_ptr<int>(std::unique_ptr<int>), extern_test::Cols);
@@ -0,0 +1,39 @@
+#pragma once
+// Functors whose dispatch tables are declared extern here and instantiated once in
+// dispatch_extern_instances.cpp.
+#include <poet/core/dispatch.hpp>
+
+#include <memory>
+
+namespace extern_test {
+
+using Rows = poet::inclusive_range<1, 8>;
+using Cols = std::integer_sequence<int, 2, 4, 16>;
+
+struct tile_area {
+    template<int R, int C> int operator()(int scale) const { return R * C * scale; }
+};
+
+struct tally {
+    int total = 0;
+    template<int V> void operator()(int weight) { total += V * weight; }
+};
+
+// Generic in its argument type, so a call with another type must not go through int(int).
+struct scaled_area {
+    template<int R, int C, typename T> auto operator()(T scale) const -> T { return static_cast<T>(R * C) * scale; }
+};
+
+struct boxer {
+    template<int V> auto operator()(std::unique_ptr<int> p) const -> std::unique_ptr<int> {
+        *p += V;
+        return p;
+    }
+};
+
+}// namespace extern_test
+
+POET_DECLARE_DISPATCH(extern_test::tile_area, int(int), extern_test::Rows, extern_test::Cols);
+POET_DECLARE_DISPATCH(extern_test::tally, void(int), extern_test::Rows);
+POET_DECLARE_DISPATCH(extern_test::scaled_area, int(int), extern_test::Rows, extern_test::Cols);
+POET_DECLARE_DISPATCH(extern_test::boxer, std::unique_ptr<int>(std::unique_ptr<int>), extern_test::Cols);
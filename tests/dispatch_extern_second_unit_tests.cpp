@@ -0,0 +1,31 @@
+// cppcheck-suppress-file unknownMacro
+// A second translation unit dispatching the declared keys. It sees the functors only through
+// dispatch_extern_kernels.hpp, which declares them right after defining them, so every unit
+// makes the same calls into dispatch_extern_instances.cpp.
+#include "dispatch_extern_kernels.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <tuple>
+#include <type_traits>
+
+namespace {
+using extern_test::Cols;
+using extern_test::Rows;
+using poet::dispatch;
+using poet::dispatch_param;
+
+using tile_params = std::tuple<dispatch_param<Rows>, dispatch_param<Cols>>;
+static_assert(std::is_same_v<poet::detail::declared_dispatch_for_t<extern_test::tile_area, tile_params, int>,
+                poet::dispatch_instance<extern_test::tile_area, int(int), Rows, Cols>>,
+  "every unit including the kernel header sees the declaration");
+}// namespace
+
+TEST_CASE("declared dispatch is shared by every unit that includes the declaration", "[static_dispatch][extern]") {
+    REQUIRE(dispatch(extern_test::tile_area{}, dispatch_param<Rows>{ 4 }, dispatch_param<Cols>{ 16 }, 2) == 128);
+    REQUIRE(dispatch(extern_test::tile_area{}, dispatch_param<Rows>{ 4 }, dispatch_param<Cols>{ 3 }, 2) == 0);
+
+    extern_test::tally counter;
+    dispatch(counter, dispatch_param<Rows>{ 7 }, 3);
+    REQUIRE(counter.total == 21);
+}
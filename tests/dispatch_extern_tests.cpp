@@ -0,0 +1,90 @@
+// cppcheck-suppress-file unknownMacro
+#include "dispatch_extern_kernels.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace {
+using extern_test::Cols;
+using extern_test::Rows;
+using poet::dispatch;
+using poet::dispatch_param;
+using poet::throw_on_no_match;
+
+using tile_key = poet::detail::dispatch_key<extern_test::tile_area, std::tuple<Rows, Cols>, int>;
+static_assert(std::is_same_v<poet::detail::declared_dispatch<tile_key>::type,
+                poet::dispatch_instance<extern_test::tile_area, int(int), Rows, Cols>>,
+  "POET_DECLARE_DISPATCH should register the instance for its key");
+
+using undeclared_key = poet::detail::dispatch_key<extern_test::tile_area, std::tuple<Cols, Rows>, int>;
+static_assert(std::is_void_v<poet::detail::declared_dispatch<undeclared_key>::type>,
+  "other sequence orders keep the inline table");
+
+using area_params = std::tuple<dispatch_param<Rows>, dispatch_param<Cols>>;
+using area_instance = poet::dispatch_instance<extern_test::scaled_area, int(int), Rows, Cols>;
+static_assert(std::is_same_v<poet::detail::declared_dispatch_for_t<extern_test::scaled_area, area_params, int &>,
+                area_instance>,
+  "an lvalue of the declared argument type uses the instance");
+static_assert(std::is_void_v<poet::detail::declared_dispatch_for_t<extern_test::scaled_area, area_params, double>>,
+  "other argument types keep the inline table");
+static_assert(std::is_void_v<poet::detail::declared_dispatch_for_t<extern_test::scaled_area, area_params, long>>,
+  "argument types must match exactly, not just convert");
+}// namespace
+
+TEST_CASE("declared dispatch routes through the extern instance", "[static_dispatch][extern]") {
+    for (int r = 0; r <= 9; ++r) {
+        for (const int c : { 2, 3, 4, 16 }) {
+            const bool hit = r >= 1 && r <= 8 && c != 3;
+            REQUIRE(dispatch(extern_test::tile_area{}, dispatch_param<Rows>{ r }, dispatch_param<Cols>{ c }, 3)
+                    == (hit ? r * c * 3 : 0));
+        }
+    }
+    const auto params = std::make_tuple(dispatch_param<Rows>{ 2 }, dispatch_param<Cols>{ 16 });
+    REQUIRE(dispatch(extern_test::tile_area{}, params, 1) == 32);
+
+    const extern_test::tile_area const_functor{};
+    REQUIRE(dispatch(const_functor, dispatch_param<Rows>{ 8 }, dispatch_param<Cols>{ 4 }, 1) == 32);
+}
+
+TEST_CASE("declared dispatch honours throw_on_no_match", "[static_dispatch][extern]") {
+    REQUIRE(dispatch(
+              throw_on_no_match, extern_test::tile_area{}, dispatch_param<Rows>{ 3 }, dispatch_param<Cols>{ 2 }, 1)
+            == 6);
+    REQUIRE_THROWS_AS(dispatch(throw_on_no_match,
+                        extern_test::tile_area{},
+                        dispatch_param<Rows>{ 9 },
+                        dispatch_param<Cols>{ 2 },
+                        1),
+      poet::no_match_error);
+}
+
+TEST_CASE("declared dispatch keeps stateful functors and move-only args", "[static_dispatch][extern]") {
+    extern_test::tally counter;
+    dispatch(counter, dispatch_param<Rows>{ 3 }, 2);
+    dispatch(counter, dispatch_param<Rows>{ 5 }, 1);
+    dispatch(counter, dispatch_param<Rows>{ 0 }, 100);
+    REQUIRE(counter.total == 11);
+
+    auto boxed = dispatch(extern_test::boxer{}, dispatch_param<Cols>{ 4 }, std::make_unique<int>(1));
+    REQUIRE(boxed != nullptr);
+    REQUIRE(*boxed == 5);
+}
+
+TEST_CASE("declared dispatch leaves calls with other argument types inline", "[static_dispatch][extern]") {
+    int scale = 3;
+    const auto as_int =
+      dispatch(extern_test::scaled_area{}, dispatch_param<Rows>{ 2 }, dispatch_param<Cols>{ 4 }, scale);
+    STATIC_REQUIRE(std::is_same_v<decltype(as_int), const int>);
+    REQUIRE(as_int == 24);
+
+    const auto as_double =
+      dispatch(extern_test::scaled_area{}, dispatch_param<Rows>{ 1 }, dispatch_param<Cols>{ 2 }, 1.5);
+    STATIC_REQUIRE(std::is_same_v<decltype(as_double), const double>);
+    REQUIRE(as_double == 3.0);
+
+    REQUIRE(dispatch(extern_test::scaled_area{}, dispatch_param<Rows>{ 9 }, dispatch_param<Cols>{ 2 }, 1.5) == 0.0);
+}
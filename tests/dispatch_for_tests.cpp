@@ -0,0 +1,83 @@
+#include <poet/core/dispatch_for.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace {
+using poet::dispatch_for;
+using poet::dispatch_param;
+using poet::inclusive_range;
+
+struct scale_fill {
+    std::vector<int> *out;
+    template<int Scale> void operator()(std::size_t i) const { (*out)[i] = static_cast<int>(i) * Scale; }
+};
+
+struct lane_tagger {
+    std::vector<int> *out;
+    template<int Base, typename Lane> void operator()(Lane /*lane*/, int i) const {
+        (*out)[static_cast<std::size_t>(i)] = Base + static_cast<int>(Lane::value);
+    }
+};
+
+struct pair_fill {
+    std::vector<int> *out;
+    int calls = 0;
+    template<int X, int Y> void operator()(std::size_t i) {
+        ++calls;
+        (*out)[i] = X * 100 + Y;
+    }
+};
+}// namespace
+
+TEST_CASE("dispatch_for runs the whole loop in the selected specialization", "[static_dispatch][dispatch_for]") {
+    for (int scale = 1; scale <= 4; ++scale) {
+        std::vector<int> out(13, -1);
+        dispatch_for<4>(
+          dispatch_param<inclusive_range<1, 4>>{ scale }, std::size_t{ 0 }, out.size(), scale_fill{ &out });
+        for (std::size_t i = 0; i < out.size(); ++i) { REQUIRE(out[i] == static_cast<int>(i) * scale); }
+    }
+
+    std::vector<int> untouched(5, -1);
+    dispatch_for<4>(dispatch_param<inclusive_range<1, 4>>{ 9 }, 0, 5, scale_fill{ &untouched });
+    REQUIRE(untouched == std::vector<int>(5, -1));
+}
+
+TEST_CASE("dispatch_for forwards lanes and value-form kernels", "[static_dispatch][dispatch_for]") {
+    std::vector<int> out(7, -1);
+    dispatch_for<3>(dispatch_param<std::integer_sequence<int, 10, 20>>{ 20 }, 0, 7, lane_tagger{ &out });
+    REQUIRE(out == std::vector<int>{ 20, 21, 22, 20, 21, 22, 20 });
+
+    int sum = 0;
+    dispatch_for<2>(dispatch_param<inclusive_range<0, 3>>{ 3 }, 10, 15, [&](auto scale, int i) { sum += scale * i; });
+    REQUIRE(sum == 3 * (10 + 11 + 12 + 13 + 14));
+}
+
+TEST_CASE("dispatch_for accepts N-D tuples and dispatch_set", "[static_dispatch][dispatch_for]") {
+    std::vector<int> out(6, 0);
+    pair_fill kernel{ &out };
+    const auto params =
+      std::make_tuple(dispatch_param<inclusive_range<0, 2>>{ 2 }, dispatch_param<inclusive_range<5, 7>>{ 6 });
+    dispatch_for<4>(params, std::size_t{ 0 }, out.size(), kernel);
+    REQUIRE(out == std::vector<int>(6, 206));
+    REQUIRE(kernel.calls == 6);
+
+    using DS = poet::dispatch_set<int, poet::tuple_<1, 2>, poet::tuple_<3, 4>>;
+    dispatch_for<2>(DS(3, 4), std::size_t{ 0 }, std::size_t{ 3 }, kernel);
+    REQUIRE(out == std::vector<int>{ 304, 304, 304, 206, 206, 206 });
+}
+
+TEST_CASE("dispatch_for throws on miss when asked", "[static_dispatch][dispatch_for]") {
+    std::vector<int> out(3, 0);
+    REQUIRE_THROWS_AS(dispatch_for<2>(poet::throw_on_no_match,
+                        dispatch_param<inclusive_range<1, 4>>{ 0 },
+                        std::size_t{ 0 },
+                        out.size(),
+                        scale_fill{ &out }),
+      poet::no_match_error);
+}
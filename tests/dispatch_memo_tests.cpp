@@ -0,0 +1,154 @@
+#include <poet/core/dispatch_memo.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace {
+using poet::dispatch_memo;
+using poet::dispatch_param;
+using poet::inclusive_range;
+
+// The memoized functors must be stateless, so their call counts live in globals.
+std::atomic<int> weight_calls{ 0 };
+std::atomic<int> grid_calls{ 0 };
+std::atomic<int> shared_calls{ 0 };
+
+struct quadrature_weights {
+    template<int Order> auto operator()(int scale) const -> std::vector<int> {
+        ++weight_calls;
+        std::vector<int> weights(static_cast<std::size_t>(Order));
+        for (int i = 0; i < Order; ++i) { weights[static_cast<std::size_t>(i)] = (i + 1) * scale; }
+        return weights;
+    }
+};
+
+struct grid_size {
+    template<int Rows, int Cols> auto operator()(int pad) const -> int {
+        ++grid_calls;
+        return (Rows + pad) * (Cols + pad);
+    }
+};
+
+struct shared_design {
+    template<int Taps> auto operator()(int cutoff) const -> long {
+        ++shared_calls;
+        return static_cast<long>(Taps) * 1000 + cutoff;
+    }
+};
+
+struct tiny_cache_design {
+    template<int Taps> auto operator()(int cutoff) const -> int { return Taps + cutoff; }
+};
+
+struct odd_only {
+    template<int N> auto operator()() const -> int { return N; }
+    static constexpr auto dispatch_valid(int n) -> bool { return n % 2 == 1; }
+};
+
+struct exit_design {
+    template<int Taps> auto operator()(int cutoff) const -> int { return Taps * cutoff; }
+};
+
+// Constructed before the cache below is first used, so destroyed after it would be
+// if the cache were freed at exit; run under ASan this catches a use after free.
+struct memo_at_exit {
+    memo_at_exit() = default;
+    memo_at_exit(const memo_at_exit &) = delete;
+    auto operator=(const memo_at_exit &) -> memo_at_exit & = delete;
+    ~memo_at_exit() { static_cast<void>(dispatch_memo(exit_design{}, dispatch_param<inclusive_range<1, 4>>{ 2 }, 3)); }
+};
+const memo_at_exit memo_at_exit_guard;
+}// namespace
+
+TEST_CASE("dispatch_memo computes each configuration once", "[static_dispatch][memo]") {
+    using orders = inclusive_range<1, 8>;
+    const auto first = dispatch_memo(quadrature_weights{}, dispatch_param<orders>{ 3 }, 2);
+    REQUIRE(first == std::vector<int>{ 2, 4, 6 });
+    REQUIRE(weight_calls == 1);
+
+    REQUIRE(dispatch_memo(quadrature_weights{}, dispatch_param<orders>{ 3 }, 2) == first);
+    REQUIRE(weight_calls == 1);
+
+    // A different runtime argument or compile-time value is a different entry.
+    REQUIRE(dispatch_memo(quadrature_weights{}, dispatch_param<orders>{ 3 }, 5) == std::vector<int>{ 5, 10, 15 });
+    REQUIRE(dispatch_memo(quadrature_weights{}, dispatch_param<orders>{ 2 }, 2) == std::vector<int>{ 2, 4 });
+    REQUIRE(weight_calls == 3);
+    REQUIRE(dispatch_memo(quadrature_weights{}, dispatch_param<orders>{ 2 }, 2) == std::vector<int>{ 2, 4 });
+    REQUIRE(weight_calls == 3);
+}
+
+TEST_CASE("dispatch_memo keys N-D dispatches by the flat index", "[static_dispatch][memo]") {
+    using dims = inclusive_range<1, 4>;
+    const auto params = std::make_tuple(dispatch_param<dims>{ 2 }, dispatch_param<dims>{ 3 });
+    const auto swapped = std::make_tuple(dispatch_param<dims>{ 3 }, dispatch_param<dims>{ 2 });
+    REQUIRE(dispatch_memo(grid_size{}, params, 1) == 12);
+    REQUIRE(dispatch_memo(grid_size{}, swapped, 0) == 6);
+    REQUIRE(dispatch_memo(grid_size{}, params, 1) == 12);
+    REQUIRE(dispatch_memo(grid_size{}, swapped, 0) == 6);
+    REQUIRE(grid_calls == 2);
+}
+
+TEST_CASE("dispatch_memo misses follow dispatch and are not cached", "[static_dispatch][memo]") {
+    using values = inclusive_range<1, 5>;
+    REQUIRE(dispatch_memo(odd_only{}, dispatch_param<values>{ 3 }) == 3);
+    REQUIRE(dispatch_memo(odd_only{}, dispatch_param<values>{ 4 }) == 0);
+    REQUIRE(dispatch_memo(odd_only{}, dispatch_param<values>{ 9 }) == 0);
+
+    auto strict = [](int v) { return dispatch_memo(poet::throw_on_no_match, odd_only{}, dispatch_param<values>{ v }); };
+    REQUIRE(strict(5) == 5);
+    REQUIRE_THROWS_AS(strict(9), poet::no_match_error);
+    REQUIRE_THROWS_AS(strict(2), poet::no_match_error);
+}
+
+TEST_CASE("dispatch_memo is safe to share between threads", "[static_dispatch][memo]") {
+    using taps = inclusive_range<1, 16>;
+    constexpr int thread_count = 4;
+    constexpr int rounds = 200;
+    std::atomic<int> wrong{ 0 };
+    std::vector<std::thread> workers;
+    workers.reserve(thread_count);
+    for (int t = 0; t < thread_count; ++t) {
+        workers.emplace_back([&wrong] {
+            for (int r = 0; r < rounds; ++r) {
+                const int n = 1 + (r % 16);
+                const int cutoff = r % 3;
+                if (dispatch_memo<256>(shared_design{}, dispatch_param<taps>{ n }, cutoff) != n * 1000L + cutoff) {
+                    ++wrong;
+                }
+            }
+        });
+    }
+    for (auto &worker : workers) { worker.join(); }
+    REQUIRE(wrong == 0);
+    // Threads racing on a new key may each compute it once before it is published.
+    REQUIRE(shared_calls >= 48);
+    REQUIRE(shared_calls <= 48 * thread_count);
+
+    // Every one of the 48 keys found a slot, so replaying them computes nothing.
+    const int settled = shared_calls;
+    for (int r = 0; r < 48; ++r) {
+        const int n = 1 + (r % 16);
+        REQUIRE(dispatch_memo<256>(shared_design{}, dispatch_param<taps>{ n }, r % 3) == n * 1000L + r % 3);
+    }
+    REQUIRE(shared_calls == settled);
+}
+
+TEST_CASE("dispatch_memo recomputes keys that find their slots taken", "[static_dispatch][memo]") {
+    using taps = inclusive_range<1, 8>;
+    // A one-slot cache keeps whichever key arrives first and still answers the others.
+    for (int round = 0; round < 3; ++round) {
+        for (int n = 1; n <= 8; ++n) {
+            REQUIRE(dispatch_memo<1>(tiny_cache_design{}, dispatch_param<taps>{ n }, 10) == n + 10);
+        }
+    }
+}
+
+TEST_CASE("dispatch_memo caches stay valid during static destruction", "[static_dispatch][memo]") {
+    // Fills the cache that memo_at_exit_guard reads again from its destructor.
+    REQUIRE(dispatch_memo(exit_design{}, dispatch_param<inclusive_range<1, 4>>{ 2 }, 3) == 6);
+}
@@ -0,0 +1,138 @@
+#include <poet/core/dispatch_plan.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace {
+using poet::dispatch_param;
+using poet::dispatch_plan;
+using poet::inclusive_range;
+
+struct append_scaled {
+    template<int Scale> void operator()(std::vector<int> *out, int value) const { out->push_back(value * Scale); }
+};
+
+struct append_pair {
+    template<int X, int Y> void operator()(std::vector<int> *out) const { out->push_back(X * 10 + Y); }
+};
+
+struct counting_step {
+    int *calls;
+    template<int X> int operator()() const {
+        ++*calls;
+        return X;
+    }
+};
+
+// Larger than the default new alignment, so the arena must align against real addresses.
+struct alignas(128) wide_block {
+    int value;
+};
+
+struct check_alignment {
+    template<int X> void operator()(wide_block &block, int *misaligned) const {
+        if (reinterpret_cast<std::uintptr_t>(&block) % alignof(wide_block) != 0) { ++*misaligned; }
+        block.value += X;
+    }
+};
+
+struct tracked {
+    std::shared_ptr<int> alive;
+};
+
+struct uses_tracked {
+    template<int X> void operator()(tracked &t) const { *t.alive += X; }
+};
+}// namespace
+
+TEST_CASE("dispatch_plan replays resolved steps in order", "[static_dispatch][plan]") {
+    std::vector<int> out;
+    dispatch_plan plan;
+    REQUIRE(plan.add(append_scaled{}, dispatch_param<inclusive_range<1, 4>>{ 3 }, &out, 5));
+    using Ys = std::integer_sequence<int, 4, 8>;
+    const auto pair_params = std::make_tuple(dispatch_param<inclusive_range<0, 2>>{ 1 }, dispatch_param<Ys>{ 8 });
+    REQUIRE(plan.add(append_pair{}, pair_params, &out));
+    REQUIRE(plan.add(append_scaled{}, dispatch_param<inclusive_range<1, 4>>{ 2 }, &out, 7));
+    REQUIRE(plan.add([](auto scale, std::vector<int> *o) { o->push_back(-scale); },
+      dispatch_param<inclusive_range<1, 4>>{ 4 },
+      &out));
+    REQUIRE(plan.size() == 4);
+    REQUIRE(out.empty());
+
+    plan.run();
+    REQUIRE(out == std::vector<int>{ 15, 18, 14, -4 });
+    plan.run();
+    REQUIRE(out.size() == 8);
+    REQUIRE(out[4] == 15);
+}
+
+TEST_CASE("dispatch_plan accepts dispatch_set and reports misses", "[static_dispatch][plan]") {
+    std::vector<int> out;
+    dispatch_plan plan;
+    using DS = poet::dispatch_set<int, poet::tuple_<1, 2>, poet::tuple_<3, 4>>;
+    REQUIRE(plan.add(append_pair{}, DS(3, 4), &out));
+    REQUIRE_FALSE(plan.add(append_pair{}, DS(2, 2), &out));
+    REQUIRE_FALSE(plan.add(append_scaled{}, dispatch_param<inclusive_range<1, 4>>{ 9 }, &out, 1));
+    REQUIRE_THROWS_AS(
+      plan.add(poet::throw_on_no_match, append_scaled{}, dispatch_param<inclusive_range<1, 4>>{ 0 }, &out, 1),
+      poet::no_match_error);
+    REQUIRE(plan.size() == 1);
+    plan.run();
+    REQUIRE(out == std::vector<int>{ 34 });
+}
+
+TEST_CASE("dispatch_plan owns copies of functors and arguments", "[static_dispatch][plan]") {
+    int calls = 0;
+    auto alive = std::make_shared<int>(0);
+    {
+        dispatch_plan plan;
+        for (int i = 0; i < 200; ++i) {
+            plan.add(counting_step{ &calls }, dispatch_param<inclusive_range<0, 7>>{ i % 8 });
+        }
+        plan.add(uses_tracked{}, dispatch_param<inclusive_range<0, 7>>{ 5 }, tracked{ alive });
+        REQUIRE(alive.use_count() == 2);
+
+        dispatch_plan moved = std::move(plan);
+        moved.run();
+        REQUIRE(calls == 200);
+        REQUIRE(*alive == 5);
+
+        plan = std::move(moved);
+        plan.run();
+        REQUIRE(calls == 400);
+        REQUIRE(*alive == 10);
+        REQUIRE(moved.empty());
+    }
+    REQUIRE(alive.use_count() == 1);
+}
+
+TEST_CASE("plan_arena aligns over-aligned blocks at every chunk offset", "[static_dispatch][plan]") {
+    for (std::size_t lead = 1; lead <= 128; ++lead) {
+        poet::detail::plan_arena arena;
+        REQUIRE(arena.allocate(lead, 1) != nullptr);
+        for (int i = 0; i < 40; ++i) {
+            void *block = arena.allocate(256, 128);
+            REQUIRE(block != nullptr);
+            REQUIRE(reinterpret_cast<std::uintptr_t>(block) % 128 == 0);
+        }
+    }
+}
+
+TEST_CASE("dispatch_plan aligns over-aligned blocks across arena chunks", "[static_dispatch][plan]") {
+    int misaligned = 0;
+    dispatch_plan plan;
+    // Enough 256-byte blocks to fill several 4 KiB chunks.
+    for (int i = 0; i < 100; ++i) {
+        REQUIRE(plan.add(
+          check_alignment{}, dispatch_param<inclusive_range<1, 3>>{ 1 + i % 3 }, wide_block{ i }, &misaligned));
+    }
+    plan.run();
+    REQUIRE(misaligned == 0);
+}
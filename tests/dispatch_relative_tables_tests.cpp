@@ -0,0 +1,136 @@
+// cppcheck-suppress-file unknownMacro
+// Runs the dispatch entry points through the relocation-free switch path. The macro changes
+// generated code, so this file is built as its own executable, which sets
+// POET_DISPATCH_RELATIVE_TABLES=1 on the command line (the test PCH includes poet.hpp first).
+#include <poet/core/dispatch.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+static_assert(poet::detail::use_relative_tables, "relative tables should be enabled in this translation unit");
+
+namespace {
+using poet::dispatch;
+using poet::dispatch_param;
+using poet::inclusive_range;
+using poet::throw_on_no_match;
+
+struct scaled {
+    template<int X> int operator()(int base) const { return base + X * 3; }
+};
+
+struct pair_sum {
+    template<int X, int Y> int operator()(int base) const { return base + X * 1000 + Y; }
+};
+
+struct upper_pairs {
+    static constexpr bool dispatch_valid(int x, int y) { return x <= y; }
+    template<int X, int Y> int operator()(int base) const {
+        static_assert(X <= Y, "invalid combinations must not be instantiated");
+        return base + X * 1000 + Y;
+    }
+};
+
+struct counting {
+    int calls = 0;
+    template<int X> int operator()(int base) {
+        ++calls;
+        return base + X;
+    }
+};
+
+struct recorder {
+    std::vector<int> *seen;
+    template<int X> void operator()() const { seen->push_back(X); }
+};
+
+struct boxer {
+    template<int X> auto operator()(std::unique_ptr<int> p) const -> std::unique_ptr<int> {
+        *p += X;
+        return p;
+    }
+};
+
+struct capacity {
+    template<int C> int operator()(int requested) const { return C * 100 + requested; }
+};
+}// namespace
+
+TEST_CASE("relative tables dispatch contiguous 1-D ranges", "[static_dispatch][relative]") {
+    for (int v = -4; v <= 12; ++v) {
+        REQUIRE(dispatch(scaled{}, dispatch_param<inclusive_range<-4, 12>>{ v }, 5) == 5 + v * 3);
+    }
+    REQUIRE(dispatch(scaled{}, dispatch_param<inclusive_range<-4, 12>>{ 13 }, 5) == 0);
+}
+
+TEST_CASE("relative tables dispatch sparse 1-D sequences", "[static_dispatch][relative]") {
+    using Sparse = std::integer_sequence<int, 40, -7, 1000, 3>;
+    for (int v : { 40, -7, 1000, 3 }) { REQUIRE(dispatch(scaled{}, dispatch_param<Sparse>{ v }, 1) == 1 + v * 3); }
+    REQUIRE(dispatch(scaled{}, dispatch_param<Sparse>{ 4 }, 1) == 0);
+}
+
+TEST_CASE("relative tables cover more than one switch level", "[static_dispatch][relative]") {
+    // 64 cases fit a single switch; 300 needs an outer level.
+    for (int v = 0; v < 300; ++v) {
+        REQUIRE(dispatch(scaled{}, dispatch_param<inclusive_range<0, 299>>{ v }, 0) == v * 3);
+    }
+
+    // Two outer levels, exercised on the bare switch to keep the build light.
+    auto identity = [](auto slot) -> std::size_t { return decltype(slot)::value; };
+    for (std::size_t idx = 0; idx < 5000; idx += 37) {
+        REQUIRE(poet::detail::switch_invoke<0, 5000, std::size_t>(idx, identity) == idx);
+    }
+    REQUIRE(poet::detail::switch_invoke<0, 5000, std::size_t>(4999, identity) == 4999);
+}
+
+TEST_CASE("relative tables dispatch N-D parameters", "[static_dispatch][relative]") {
+    using Xs = inclusive_range<0, 9>;
+    using Ys = std::integer_sequence<int, 2, 8, 32>;
+    for (int x = 0; x <= 9; ++x) {
+        for (int y : { 2, 8, 32 }) {
+            REQUIRE(dispatch(pair_sum{}, dispatch_param<Xs>{ x }, dispatch_param<Ys>{ y }, 1) == 1 + x * 1000 + y);
+        }
+    }
+    REQUIRE(dispatch(pair_sum{}, dispatch_param<Xs>{ 3 }, dispatch_param<Ys>{ 4 }, 1) == 0);
+}
+
+TEST_CASE("relative tables dispatch narrowed N-D parameters", "[static_dispatch][relative]") {
+    using Xs = inclusive_range<0, 5>;
+    for (int x = 0; x <= 5; ++x) {
+        for (int y = 0; y <= 5; ++y) {
+            const int expected = x <= y ? 1 + x * 1000 + y : 0;
+            REQUIRE(dispatch(upper_pairs{}, dispatch_param<Xs>{ x }, dispatch_param<Xs>{ y }, 1) == expected);
+        }
+    }
+}
+
+TEST_CASE("relative tables keep stateful functors, void and move-only args", "[static_dispatch][relative]") {
+    counting counter;
+    REQUIRE(dispatch(counter, dispatch_param<inclusive_range<0, 3>>{ 2 }, 10) == 12);
+    REQUIRE(dispatch(counter, dispatch_param<inclusive_range<0, 3>>{ 3 }, 10) == 13);
+    REQUIRE(counter.calls == 2);
+
+    std::vector<int> seen;
+    dispatch(recorder{ &seen }, dispatch_param<inclusive_range<1, 5>>{ 4 });
+    dispatch(recorder{ &seen }, dispatch_param<inclusive_range<1, 5>>{ 9 });
+    REQUIRE(seen == std::vector<int>{ 4 });
+
+    auto boxed = dispatch(boxer{}, dispatch_param<inclusive_range<0, 7>>{ 6 }, std::make_unique<int>(1));
+    REQUIRE(boxed != nullptr);
+    REQUIRE(*boxed == 7);
+}
+
+TEST_CASE("relative tables honour throw_on_no_match", "[static_dispatch][relative]") {
+    REQUIRE(dispatch(throw_on_no_match, scaled{}, dispatch_param<inclusive_range<0, 3>>{ 1 }, 0) == 3);
+    REQUIRE_THROWS_AS(
+      dispatch(throw_on_no_match, scaled{}, dispatch_param<inclusive_range<0, 3>>{ 4 }, 0), std::runtime_error);
+}
+
+TEST_CASE("relative tables back dispatch_round_up", "[static_dispatch][relative]") {
+    REQUIRE(poet::dispatch_round_up(capacity{}, dispatch_param<std::integer_sequence<int, 8, 16, 64>>{ 9 }) == 1609);
+}
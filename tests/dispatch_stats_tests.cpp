@@ -0,0 +1,128 @@
+// cppcheck-suppress-file unknownMacro
+// Counts dispatches per specialization. The macro changes generated code, so this file is
+// built as its own executable, which sets POET_DISPATCH_STATS=1 on the command line (the test
+// PCH includes poet.hpp first).
+#include <poet/core/dispatch.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+static_assert(poet::detail::dispatch_stats_enabled, "stats should be enabled in this translation unit");
+
+namespace {
+using poet::dispatch;
+using poet::dispatch_param;
+using poet::inclusive_range;
+
+struct stats_scaled {
+    template<int X> int operator()(int base) const { return base + X; }
+};
+
+struct stats_threaded {
+    template<int X> int operator()(int base) const { return base * X; }
+};
+
+struct stats_pair {
+    template<int X, int Y> int operator()() const { return X * 10 + Y; }
+};
+
+struct stats_tuple {
+    template<int X, int Y> int operator()() const { return X + Y; }
+};
+
+template<typename Functor> auto site_of() -> poet::dispatch_site_stats {
+    const std::string name = std::string(poet::detail::type_name<Functor>());
+    for (auto &site : poet::dispatch_stats_snapshot()) {
+        if (site.functor == name) { return site; }
+    }
+    return {};
+}
+
+auto hits_of(const poet::dispatch_site_stats &site, const std::vector<int> &values) -> std::uint64_t {
+    const auto it = std::find_if(
+      site.slots.begin(), site.slots.end(), [&](const poet::dispatch_slot_count &s) { return s.values == values; });
+    return it == site.slots.end() ? 0 : it->hits;
+}
+}// namespace
+
+TEST_CASE("dispatch stats count hits and misses per 1-D slot", "[static_dispatch][stats]") {
+    poet::dispatch_stats_reset();
+    using Seq = std::integer_sequence<int, 8, 2, 4>;
+    for (int i = 0; i < 5; ++i) { dispatch(stats_scaled{}, dispatch_param<Seq>{ 4 }, 0); }
+    dispatch(stats_scaled{}, dispatch_param<Seq>{ 8 }, 0);
+    dispatch(stats_scaled{}, dispatch_param<Seq>{ 3 }, 0);
+
+    const auto site = site_of<stats_scaled>();
+    REQUIRE(site.slots.size() == 3);
+    REQUIRE(hits_of(site, { 4 }) == 5);
+    REQUIRE(hits_of(site, { 8 }) == 1);
+    REQUIRE(hits_of(site, { 2 }) == 0);
+    REQUIRE(site.misses == 1);
+}
+
+TEST_CASE("dispatch stats key N-D slots by their values", "[static_dispatch][stats]") {
+    poet::dispatch_stats_reset();
+    using Xs = inclusive_range<0, 2>;
+    using Ys = std::integer_sequence<int, 5, 7>;
+    REQUIRE(dispatch(stats_pair{}, dispatch_param<Xs>{ 1 }, dispatch_param<Ys>{ 7 }) == 17);
+    dispatch(stats_pair{}, dispatch_param<Xs>{ 1 }, dispatch_param<Ys>{ 7 });
+    dispatch(stats_pair{}, dispatch_param<Xs>{ 2 }, dispatch_param<Ys>{ 5 });
+    dispatch(stats_pair{}, dispatch_param<Xs>{ 3 }, dispatch_param<Ys>{ 5 });
+
+    const auto site = site_of<stats_pair>();
+    REQUIRE(site.slots.size() == 6);
+    REQUIRE(hits_of(site, { 1, 7 }) == 2);
+    REQUIRE(hits_of(site, { 2, 5 }) == 1);
+    REQUIRE(site.misses == 1);
+}
+
+TEST_CASE("dispatch stats cover dispatch_set tuples", "[static_dispatch][stats]") {
+    poet::dispatch_stats_reset();
+    using DS = poet::dispatch_set<int, poet::tuple_<1, 2>, poet::tuple_<3, 4>>;
+    dispatch(stats_tuple{}, DS(3, 4));
+    dispatch(stats_tuple{}, DS(3, 4));
+    dispatch(stats_tuple{}, DS(1, 1));
+
+    const auto site = site_of<stats_tuple>();
+    REQUIRE(hits_of(site, { 3, 4 }) == 2);
+    REQUIRE(hits_of(site, { 1, 2 }) == 0);
+    REQUIRE(site.misses == 1);
+}
+
+TEST_CASE("dispatch stats sum counters across threads", "[static_dispatch][stats]") {
+    poet::dispatch_stats_reset();
+    using Seq = inclusive_range<0, 3>;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([t] {
+            for (int i = 0; i < 100; ++i) { dispatch(stats_threaded{}, dispatch_param<Seq>{ t }, 0); }
+        });
+    }
+    for (auto &worker : workers) { worker.join(); }
+    dispatch(stats_threaded{}, dispatch_param<Seq>{ 0 }, 0);
+
+    const auto site = site_of<stats_threaded>();
+    REQUIRE(hits_of(site, { 0 }) == 101);
+    REQUIRE(hits_of(site, { 3 }) == 100);
+}
+
+TEST_CASE("dispatch_stats_dump prints a histogram per site", "[static_dispatch][stats]") {
+    poet::dispatch_stats_reset();
+    using Seq = inclusive_range<0, 3>;
+    dispatch(stats_scaled{}, dispatch_param<Seq>{ 2 }, 0);
+    dispatch(stats_scaled{}, dispatch_param<Seq>{ 9 }, 0);
+
+    std::ostringstream out;
+    poet::dispatch_stats_dump(out);
+    const std::string text = out.str();
+    REQUIRE(text.find("stats_scaled") != std::string::npos);
+    REQUIRE(text.find("  <2> 1 ####") != std::string::npos);
+    REQUIRE(text.find("3 of 4 specializations unused") != std::string::npos);
+}
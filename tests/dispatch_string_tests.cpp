@@ -0,0 +1,99 @@
+#include <poet/core/dispatch_string.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#if __cplusplus >= 202002L
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+using poet::dispatch_string;
+using poet::fixed_string;
+
+struct kernel_id {
+    template<fixed_string Key> int operator()(int base) const {
+        if constexpr (Key.view() == "avx2_fast") {
+            return base + 1;
+        } else if constexpr (Key.view() == "exact") {
+            return base + 2;
+        } else {
+            return base + static_cast<int>(Key.size()) * 10;
+        }
+    }
+};
+
+struct name_recorder {
+    std::vector<std::string> *seen;
+    template<fixed_string Key> void operator()() const { seen->emplace_back(Key.view()); }
+};
+
+// Viable both ways; the explicit template argument form takes precedence.
+struct both_forms {
+    template<fixed_string Key> int operator()() const { return 1; }
+    template<fixed_string Key> int operator()(poet::string_constant<Key> /*key*/) const { return 2; }
+};
+
+struct counting_keys {
+    int calls = 0;
+    template<fixed_string Key> auto operator()() -> std::size_t {
+        ++calls;
+        return Key.size();
+    }
+};
+}// namespace
+
+TEST_CASE("dispatch_string selects the specialization for each key", "[static_dispatch][string]") {
+    REQUIRE(dispatch_string<"avx2_fast", "exact", "blocked">("avx2_fast", kernel_id{}, 100) == 101);
+    REQUIRE(dispatch_string<"avx2_fast", "exact", "blocked">("exact", kernel_id{}, 100) == 102);
+    REQUIRE(dispatch_string<"avx2_fast", "exact", "blocked">(std::string("blocked"), kernel_id{}, 100) == 170);
+}
+
+TEST_CASE("dispatch_string rejects near misses", "[static_dispatch][string]") {
+    for (std::string_view miss : { std::string_view{}, std::string_view(""), std::string_view("exac"),
+           std::string_view("exactly"), std::string_view("Exact"), std::string_view("avx2_fasT"),
+           std::string_view("zzzzzzzz") }) {
+        REQUIRE(dispatch_string<"avx2_fast", "exact", "blocked">(miss, kernel_id{}, 100) == 0);
+    }
+    REQUIRE(dispatch_string<"avx2_fast", "exact">(std::string_view("exact\0", 6), kernel_id{}, 1) == 0);
+    REQUIRE_THROWS_AS(
+      dispatch_string<"exact">(poet::throw_on_no_match, "blocked", kernel_id{}, 1), poet::no_match_error);
+    REQUIRE(dispatch_string<"exact">(poet::throw_on_no_match, "exact", kernel_id{}, 1) == 3);
+}
+
+TEST_CASE("dispatch_string handles void, stateful and generic-lambda functors", "[static_dispatch][string]") {
+    std::vector<std::string> seen;
+    dispatch_string<"a", "bb", "">("bb", name_recorder{ &seen });
+    dispatch_string<"a", "bb", "">("", name_recorder{ &seen });
+    dispatch_string<"a", "bb", "">("c", name_recorder{ &seen });
+    dispatch_string<"a", "bb", "">(std::string_view{}, name_recorder{ &seen });
+    REQUIRE(seen == std::vector<std::string>{ "bb", "", "" });
+    REQUIRE(dispatch_string<"x", "y">("y", both_forms{}) == 1);
+
+    counting_keys counter;
+    REQUIRE(dispatch_string<"one", "three">("three", counter) == 5);
+    REQUIRE(dispatch_string<"one", "three">("one", counter) == 3);
+    REQUIRE(counter.calls == 2);
+
+    auto boxed = dispatch_string<"inc", "dec">(
+      "dec",
+      [](auto key, std::unique_ptr<int> p) {
+          *p += std::string_view(key) == "inc" ? 1 : -1;
+          return p;
+      },
+      std::make_unique<int>(10));
+    REQUIRE(*boxed == 9);
+}
+
+TEST_CASE("dispatch_string builds a collision-free table for many keys", "[static_dispatch][string]") {
+    using lookup = poet::detail::string_lookup<"k00", "k01", "k02", "k03", "k04", "k05", "k06", "k07", "k08", "k09",
+      "k10", "k11", "k12", "k13", "k14", "k15", "k16", "k17", "k18", "k19", "k20", "k21", "k22", "k23", "k24",
+      "k25", "k26", "k27", "k28", "k29", "k30", "k31">;
+    for (std::size_t i = 0; i < lookup::count; ++i) { REQUIRE(lookup::find(lookup::keys[i]) == i); }
+    REQUIRE(lookup::find("k32") == poet::detail::dispatch_npos);
+    REQUIRE(lookup::find("k0") == poet::detail::dispatch_npos);
+}
+
+#endif// __cplusplus >= 202002L
@@ -3,7 +3,9 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
 #include <array>
+#include <limits>
 #include <memory>
 #include <random>
 #include <stdexcept>
@@ -116,6 +118,71 @@ struct quad_sum {
     template<int X, int Y, int Z, int W> int operator()(int base) const { return base + X + Y + Z + W; }
 };
 
+// range dispatch_set functors
+struct block_kernel {
+    template<int K, int M> int operator()(int base) const {
+        static_assert((M == 4 || M == 8) || (K == 2 && M == 2), "uncovered combinations must not be instantiated");
+        return base + K * 100 + M;
+    }
+};
+
+struct divides {
+    constexpr bool operator()(int a, int b) const { return b % a == 0; }
+};
+
+struct stateful_pair_sum {
+    int total = 0;
+    template<int A, int B> void operator()() { total += A * 10 + B; }
+};
+
+// round-up dispatch functors: compiled capacity in the template, true size at runtime
+struct padded_sum {
+    template<int Capacity> int operator()(int n, const std::vector<int> &data) const {
+        std::array<int, static_cast<std::size_t>(Capacity)> lanes{};
+        for (int i = 0; i < n; ++i) { lanes[static_cast<std::size_t>(i)] = data[static_cast<std::size_t>(i)]; }
+        int total = 0;
+        for (const int v : lanes) { total += v; }
+        return total * 1000 + Capacity;
+    }
+};
+
+struct chunk_recorder {
+    std::vector<std::pair<int, std::size_t>> *chunks;
+    template<int Size> void operator()(std::size_t offset) const { chunks->emplace_back(Size, offset); }
+};
+
+struct capacity_reporter {
+    int *capacity;
+    int *size;
+    template<int Capacity> void operator()(int n) const {
+        *capacity = Capacity;
+        *size = n;
+    }
+};
+
+// narrowed N-D tables: only M <= N is legal and the body never reads K
+struct triangular_kernel {
+    using dispatch_ignored_dims = std::index_sequence<2>;
+    static constexpr bool dispatch_valid(int m, int n, int /*k*/) { return m <= n; }
+
+    template<int M, int N, int K> int operator()(int base) const {
+        static_assert(M <= N, "invalid combinations must not be instantiated");
+        return base + M * 100 + N;
+    }
+};
+
+struct even_only_counter {
+    int *calls;
+    static constexpr bool dispatch_valid(int v) { return v % 2 == 0; }
+
+    template<int V> void operator()(int scale) const { *calls += V * scale; }
+};
+
+struct ignores_first {
+    using dispatch_ignored_dims = std::index_sequence<0>;
+    template<int A, int B> int operator()() const { return A * 1000 + B; }
+};
+
 }// namespace
 
 // ============================================================================
@@ -410,6 +477,379 @@ TEST_CASE("dispatch non-strided sparse 1D miss cases", "[static_dispatch][sparse
     }
 }
 
+// ============================================================================
+// Sparse 1D dispatch — geometric (power-of-two ratio) path
+// ============================================================================
+
+static_assert(std::is_same_v<poet::pow2_range<1, 16>, std::integer_sequence<int, 1, 2, 4, 8, 16>>,
+  "pow2_range should enumerate every power of two in [Lo, Hi]");
+static_assert(std::is_same_v<poet::pow2_range<4, 40>, std::integer_sequence<int, 4, 8, 16, 32>>,
+  "pow2_range should stop at the last power of two <= Hi");
+static_assert(std::is_same_v<poet::geometric_range<3, 200, 4>, std::integer_sequence<int, 3, 12, 48, 192>>,
+  "geometric_range should multiply by Ratio");
+static_assert(poet::detail::seq_lookup<poet::pow2_range<1, 1024>>::geometric_shift == 1,
+  "pow2_range should take the trailing-zero lookup");
+static_assert(poet::detail::seq_lookup<poet::geometric_range<1, 4096, 8>>::geometric_shift == 3,
+  "power-of-two ratios should take the trailing-zero lookup");
+static_assert(!poet::detail::seq_lookup<poet::geometric_range<1, 81, 3>>::is_geometric,
+  "non power-of-two ratios fall back to binary search");
+static_assert(!poet::detail::seq_lookup<std::integer_sequence<int, 1, 2, 4, 9>>::is_geometric,
+  "a broken progression must not take the geometric path");
+
+TEST_CASE("dispatch pow2_range hits every power of two", "[static_dispatch][sparse][geometric]") {
+    for (int val = 1; val <= 1024; val *= 2) {
+        bool invoked = false;
+        const auto result = dispatch(guard_dispatcher{ &invoked }, dispatch_param<poet::pow2_range<1, 1024>>{ val }, 0);
+        REQUIRE(result == val);
+        REQUIRE(invoked);
+    }
+}
+
+TEST_CASE("dispatch pow2_range miss cases", "[static_dispatch][sparse][geometric]") {
+    using Pow2 = poet::pow2_range<4, 256>;
+    for (int val : { std::numeric_limits<int>::min(), -4, 0, 1, 2, 3, 6, 12, 255, 512, 1 << 30 }) {
+        bool invoked = false;
+        const auto result = dispatch(guard_dispatcher{ &invoked }, dispatch_param<Pow2>{ val }, 0);
+        REQUIRE(result == 0);
+        REQUIRE_FALSE(invoked);
+    }
+}
+
+TEST_CASE("dispatch geometric_range with non power-of-two start and ratio 4",
+  "[static_dispatch][sparse][geometric]") {
+    using Geo = poet::geometric_range<3, 3072, 4>;
+    for (int val : { 3, 12, 48, 192, 768, 3072 }) {
+        bool invoked = false;
+        REQUIRE(dispatch(guard_dispatcher{ &invoked }, dispatch_param<Geo>{ val }, 0) == val);
+        REQUIRE(invoked);
+    }
+    for (int val : { 1, 6, 24, 96, 5, 15, 12288 }) {
+        bool invoked = false;
+        REQUIRE(dispatch(guard_dispatcher{ &invoked }, dispatch_param<Geo>{ val }, 0) == 0);
+        REQUIRE_FALSE(invoked);
+    }
+}
+
+TEST_CASE("dispatch geometric lookup preserves declared slot order", "[static_dispatch][sparse][geometric]") {
+    using Descending = std::integer_sequence<int, 64, 16, 4, 1>;
+    static_assert(poet::detail::seq_lookup<Descending>::is_geometric, "declaration order must not matter");
+    for (int val : { 1, 4, 16, 64 }) {
+        int out = -1;
+        dispatch(duplicate_reporter{ &out }, dispatch_param<Descending>{ val });
+        REQUIRE(out == val);
+    }
+}
+
+TEST_CASE("dispatch pow2_range in N-D tables", "[static_dispatch][sparse][geometric][nd]") {
+    for (int x = 1; x <= 8; x *= 2) {
+        for (int y = 0; y <= 2; ++y) {
+            for (int z = 2; z <= 32; z *= 2) {
+                const auto result = dispatch(sum_dispatcher{},
+                  dispatch_param<poet::pow2_range<1, 8>>{ x },
+                  dispatch_param<inclusive_range<0, 2>>{ y },
+                  dispatch_param<poet::pow2_range<2, 32>>{ z },
+                  100);
+                REQUIRE(result == 100 + x + y + z);
+            }
+        }
+    }
+    REQUIRE(dispatch(sum_dispatcher{},
+              dispatch_param<poet::pow2_range<1, 8>>{ 3 },
+              dispatch_param<inclusive_range<0, 2>>{ 0 },
+              dispatch_param<poet::pow2_range<2, 32>>{ 2 },
+              100)
+            == 0);
+}
+
+// ============================================================================
+// Sparse 1D dispatch — direct table / compare scan / Eytzinger paths
+// ============================================================================
+
+namespace {
+template<int... Is>
+auto squares_plus_seven(std::integer_sequence<int, Is...>) -> std::integer_sequence<int, (Is * Is * 97 + 7)...>;
+
+using NarrowSparse = std::integer_sequence<int, 40, -3, 17, 200, 5>;
+using WideSparse = std::integer_sequence<int, -1000000, 12, 99999, 4096, 123456789>;
+using LargeSparse = decltype(squares_plus_seven(std::make_integer_sequence<int, 100>{}));
+using ExtremeSparse = std::integer_sequence<int,
+  std::numeric_limits<int>::max(),
+  std::numeric_limits<int>::min(),
+  0,
+  1,
+  3,
+  7,
+  15,
+  31,
+  63,
+  127,
+  255,
+  511,
+  1023,
+  2047,
+  4095,
+  8191,
+  16383,
+  32767,
+  65535,
+  131071,
+  262143,
+  524287,
+  1048575,
+  2097151,
+  4194303,
+  8388607,
+  16777215,
+  33554431,
+  67108863,
+  134217727,
+  268435455,
+  536870911,
+  1073741823>;
+
+struct identity_dispatcher {
+    template<int V> int operator()() const { return V; }
+};
+
+template<typename Seq> struct sparse_checker;
+
+template<int... Vs> struct sparse_checker<std::integer_sequence<int, Vs...>> {
+    static void check_all(int lo, int hi) {
+        for (const int v : { Vs... }) {
+            REQUIRE(dispatch(identity_dispatcher{}, dispatch_param<std::integer_sequence<int, Vs...>>{ v }) == v);
+            for (const int delta : { -1, 1 }) {
+                const auto probe = static_cast<long long>(v) + delta;
+                if (probe < std::numeric_limits<int>::min() || probe > std::numeric_limits<int>::max()) { continue; }
+                const auto near = static_cast<int>(probe);
+                if (((near == Vs) || ...)) { continue; }
+                REQUIRE_THROWS_AS(
+                  dispatch(throw_on_no_match, identity_dispatcher{}, dispatch_param<std::integer_sequence<int, Vs...>>{ near }),
+                  poet::no_match_error);
+            }
+        }
+        for (int v = lo; v <= hi; ++v) {
+            const bool member = ((v == Vs) || ...);
+            const int out = dispatch(identity_dispatcher{}, dispatch_param<std::integer_sequence<int, Vs...>>{ v });
+            REQUIRE(out == (member ? v : 0));
+        }
+    }
+};
+}// namespace
+
+static_assert(poet::detail::seq_lookup<NarrowSparse>::kind == poet::detail::sparse_lookup_kind::direct_table,
+  "narrow spans should use the direct table");
+static_assert(poet::detail::seq_lookup<WideSparse>::kind == poet::detail::sparse_lookup_kind::linear_scan,
+  "wide spans with few keys should use the compare scan");
+static_assert(poet::detail::seq_lookup<LargeSparse>::kind == poet::detail::sparse_lookup_kind::eytzinger,
+  "wide spans with many keys should use the Eytzinger search");
+static_assert(poet::detail::seq_lookup<ExtremeSparse>::kind == poet::detail::sparse_lookup_kind::eytzinger,
+  "full-range keys should use the Eytzinger search");
+
+TEST_CASE("dispatch sparse direct-table lookup", "[static_dispatch][sparse][direct]") {
+    sparse_checker<NarrowSparse>::check_all(-10, 210);
+}
+
+TEST_CASE("dispatch sparse compare-scan lookup", "[static_dispatch][sparse][scan]") {
+    sparse_checker<WideSparse>::check_all(-20, 5000);
+}
+
+TEST_CASE("dispatch sparse Eytzinger lookup", "[static_dispatch][sparse][eytzinger]") {
+    sparse_checker<LargeSparse>::check_all(-5, 4000);
+    sparse_checker<ExtremeSparse>::check_all(-300, 300);
+}
+
+TEST_CASE("dispatch sparse lookups keep declared slots with duplicates", "[static_dispatch][sparse][duplicates]") {
+    // Duplicates widen value_count past unique_count; the first declaration wins.
+    using DupNarrow = std::integer_sequence<int, 9, 2, 9, 50>;
+    using DupWide = std::integer_sequence<int, 70000, 2, 70000, -9>;
+    REQUIRE(poet::detail::seq_lookup<DupNarrow>::find(9) == 0);
+    REQUIRE(poet::detail::seq_lookup<DupNarrow>::find(50) == 3);
+    REQUIRE(poet::detail::seq_lookup<DupWide>::find(70000) == 0);
+    REQUIRE(poet::detail::seq_lookup<DupWide>::find(-9) == 3);
+    REQUIRE(poet::detail::seq_lookup<LargeSparse>::find(7 + (99 * 99 * 97)) == 99);
+    REQUIRE(poet::detail::seq_lookup<LargeSparse>::find(7) == 0);
+}
+
+// ============================================================================
+// Round-up dispatch
+// ============================================================================
+
+TEST_CASE("dispatch_round_up selects the smallest compiled value >= n", "[static_dispatch][round_up]") {
+    using Sizes = poet::pow2_range<1, 16>;
+    const std::array<int, 17> expected{ 1, 1, 2, 4, 4, 8, 8, 8, 8, 16, 16, 16, 16, 16, 16, 16, 16 };
+    for (int n = 0; n <= 16; ++n) {
+        int capacity = -1;
+        int size = -1;
+        poet::dispatch_round_up(capacity_reporter{ &capacity, &size }, dispatch_param<Sizes>{ n });
+        REQUIRE(capacity == expected[static_cast<std::size_t>(n)]);
+        REQUIRE(size == n);
+    }
+}
+
+TEST_CASE("dispatch_round_up forwards the true size and extra args", "[static_dispatch][round_up]") {
+    const std::vector<int> data{ 1, 2, 3, 4, 5 };
+    const int result = poet::dispatch_round_up(padded_sum{}, dispatch_param<poet::pow2_range<1, 64>>{ 5 }, data);
+    REQUIRE(result == 15 * 1000 + 8);
+}
+
+TEST_CASE("dispatch_round_up on contiguous and sparse sequences", "[static_dispatch][round_up]") {
+    int capacity = -1;
+    int size = -1;
+
+    poet::dispatch_round_up(capacity_reporter{ &capacity, &size }, dispatch_param<inclusive_range<4, 7>>{ -3 });
+    REQUIRE(capacity == 4);
+    poet::dispatch_round_up(capacity_reporter{ &capacity, &size }, dispatch_param<inclusive_range<4, 7>>{ 6 });
+    REQUIRE(capacity == 6);
+
+    // Declared out of order: slot remapping must still land on the right specialization.
+    using Unordered = std::integer_sequence<int, 24, 3, 10>;
+    const std::vector<std::pair<int, int>> cases{ { 0, 3 }, { 3, 3 }, { 4, 10 }, { 11, 24 }, { 24, 24 } };
+    for (const auto &[n, cap] : cases) {
+        poet::dispatch_round_up(capacity_reporter{ &capacity, &size }, dispatch_param<Unordered>{ n });
+        REQUIRE(capacity == cap);
+        REQUIRE(size == n);
+    }
+}
+
+TEST_CASE("dispatch_round_up misses above the largest candidate", "[static_dispatch][round_up]") {
+    bool invoked = false;
+    const auto pow2_miss = poet::dispatch_round_up(
+      [&invoked](auto cap, int n) {
+          invoked = true;
+          return static_cast<int>(cap) + n;
+      },
+      dispatch_param<poet::pow2_range<1, 8>>{ 9 });
+    REQUIRE(pow2_miss == 0);
+    REQUIRE_FALSE(invoked);
+
+    int capacity = -1;
+    int size = -1;
+    REQUIRE_THROWS_AS(poet::dispatch_round_up(throw_on_no_match,
+                        capacity_reporter{ &capacity, &size },
+                        dispatch_param<inclusive_range<1, 4>>{ 5 }),
+      poet::no_match_error);
+    REQUIRE(capacity == -1);
+}
+
+// ============================================================================
+// Size decomposition dispatch
+// ============================================================================
+
+TEST_CASE("dispatch_decompose covers n with power-of-two chunks", "[static_dispatch][decompose]") {
+    using chunk_list = std::vector<std::pair<int, std::size_t>>;
+    chunk_list chunks;
+
+    REQUIRE(poet::dispatch_decompose<1, 2, 4, 8>(13, chunk_recorder{ &chunks }, std::size_t{ 0 }) == 0);
+    REQUIRE(chunks == chunk_list{ { 8, 0 }, { 4, 8 }, { 1, 12 } });
+
+    chunks.clear();
+    REQUIRE(poet::dispatch_decompose<1, 2, 4, 8>(29, chunk_recorder{ &chunks }, std::size_t{ 100 }) == 0);
+    REQUIRE(chunks == chunk_list{ { 8, 100 }, { 8, 108 }, { 8, 116 }, { 4, 124 }, { 1, 128 } });
+
+    chunks.clear();
+    REQUIRE(poet::dispatch_decompose<1, 2, 4, 8>(0, chunk_recorder{ &chunks }, std::size_t{ 0 }) == 0);
+    REQUIRE(chunks.empty());
+}
+
+TEST_CASE("dispatch_decompose with gaps returns the uncovered remainder", "[static_dispatch][decompose]") {
+    using chunk_list = std::vector<std::pair<int, std::size_t>>;
+    chunk_list chunks;
+
+    // Declaration order does not matter; 27 = 16 + 4 + 4 with 3 left over.
+    REQUIRE(poet::dispatch_decompose<4, 16>(27, chunk_recorder{ &chunks }, std::size_t{ 0 }) == 3);
+    REQUIRE(chunks == chunk_list{ { 16, 0 }, { 4, 16 }, { 4, 20 } });
+
+    chunks.clear();
+    REQUIRE(poet::dispatch_decompose<3, 7>(19, chunk_recorder{ &chunks }, std::size_t{ 0 }) == 2);
+    REQUIRE(chunks == chunk_list{ { 7, 0 }, { 7, 7 }, { 3, 14 } });
+}
+
+TEST_CASE("dispatch_decompose covers every element exactly once", "[static_dispatch][decompose]") {
+    for (std::size_t n = 0; n <= 70; ++n) {
+        std::vector<int> data(n, 0);
+        const auto rem = poet::dispatch_decompose<1, 2, 4, 8, 16>(
+          n,
+          [](auto size, int offset, std::vector<int> &out) {
+              for (int i = 0; i < size; ++i) { ++out[static_cast<std::size_t>(offset + i)]; }
+          },
+          0,
+          data);
+        REQUIRE(rem == 0);
+        REQUIRE(std::all_of(data.begin(), data.end(), [](int hits) { return hits == 1; }));
+    }
+}
+
+// ============================================================================
+// Narrowed N-D tables (dispatch_valid / dispatch_ignored_dims)
+// ============================================================================
+
+using TriangularSlots = poet::detail::nd_slot_map<triangular_kernel,
+  std::tuple<inclusive_range<1, 8>, inclusive_range<1, 8>, std::integer_sequence<int, 16, 32, 64>>>;
+static_assert(TriangularSlots::total == 192, "full product is 8 x 8 x 3");
+static_assert(TriangularSlots::unique_count == 36, "only M <= N pairs are instantiated, shared across K");
+static_assert(sizeof(TriangularSlots::slot_t) == 1, "slot index should use the narrowest type");
+static_assert(!poet::detail::uses_compressed_table_v<sum_dispatcher, 3>, "plain functors keep the flat table");
+
+static_assert(poet::detail::constant_key_switch_v<64>, "tables of one switch level get the constant-key path");
+static_assert(!poet::detail::constant_key_switch_v<65>, "larger tables skip it to save compile time");
+
+TEST_CASE("dispatch_valid routes legal combinations and misses the rest", "[static_dispatch][narrowed]") {
+    using Ms = inclusive_range<1, 8>;
+    using Ks = std::integer_sequence<int, 16, 32, 64>;
+    for (int m = 0; m <= 9; ++m) {
+        for (int n = 0; n <= 9; ++n) {
+            for (const int k : { 16, 32, 48, 64 }) {
+                const int result = dispatch(
+                  triangular_kernel{}, dispatch_param<Ms>{ m }, dispatch_param<Ms>{ n }, dispatch_param<Ks>{ k }, 7);
+                const bool in_range = m >= 1 && m <= 8 && n >= 1 && n <= 8 && k != 48;
+                REQUIRE(result == (in_range && m <= n ? 7 + m * 100 + n : 0));
+            }
+        }
+    }
+}
+
+TEST_CASE("dispatch_valid misses honour throw_on_no_match", "[static_dispatch][narrowed]") {
+    using Ms = inclusive_range<1, 8>;
+    using Ks = std::integer_sequence<int, 16, 32, 64>;
+    REQUIRE(dispatch(throw_on_no_match,
+              triangular_kernel{},
+              dispatch_param<Ms>{ 2 },
+              dispatch_param<Ms>{ 3 },
+              dispatch_param<Ks>{ 32 },
+              0)
+            == 203);
+    REQUIRE_THROWS_AS(dispatch(throw_on_no_match,
+                        triangular_kernel{},
+                        dispatch_param<Ms>{ 3 },
+                        dispatch_param<Ms>{ 2 },
+                        dispatch_param<Ks>{ 32 },
+                        0),
+      poet::no_match_error);
+}
+
+TEST_CASE("dispatch_valid applies to single-parameter dispatch", "[static_dispatch][narrowed]") {
+    int calls = 0;
+    for (int v = 0; v <= 9; ++v) {
+        dispatch(even_only_counter{ &calls }, dispatch_param<inclusive_range<0, 9>>{ v }, 1);
+    }
+    REQUIRE(calls == 0 + 2 + 4 + 6 + 8);
+}
+
+TEST_CASE("dispatch_ignored_dims shares one instantiation across the ignored axis", "[static_dispatch][narrowed]") {
+    using As = inclusive_range<0, 3>;
+    using Bs = inclusive_range<5, 7>;
+    using Slots = poet::detail::nd_slot_map<ignores_first, std::tuple<As, Bs>>;
+    static_assert(Slots::unique_count == 3, "one instantiation per value of the kept dimension");
+
+    for (int a = 0; a <= 3; ++a) {
+        for (int b = 5; b <= 7; ++b) {
+            // The ignored dimension is pinned to its first value.
+            REQUIRE(dispatch(ignores_first{}, dispatch_param<As>{ a }, dispatch_param<Bs>{ b }) == b);
+        }
+    }
+    REQUIRE(dispatch(ignores_first{}, dispatch_param<As>{ 4 }, dispatch_param<Bs>{ 5 }) == 0);
+}
+
 // ============================================================================
 // Stateful functor
 // ============================================================================
@@ -848,6 +1288,55 @@ TEST_CASE("dispatch_set with 3-tuples and throw_on_no_match", "[static_dispatch]
     REQUIRE_THROWS_AS(dispatch(throw_on_no_match, ::triple_sum{}, ds_invalid, 10), std::runtime_error);
 }
 
+TEST_CASE("dispatch_set product_ entries cover ranges per dimension", "[static_dispatch][tuples][ranges]") {
+    using DS = dispatch_set<int,
+      poet::product_<inclusive_range<1, 64>, std::integer_sequence<int, 4, 8>>,
+      tuple_<2, 2>>;
+    static_assert(DS::has_ranges, "product_ entries select the range path");
+
+    for (int k = 0; k <= 65; ++k) {
+        for (const int m : { 2, 4, 6, 8 }) {
+            const bool covered = (k >= 1 && k <= 64 && (m == 4 || m == 8)) || (k == 2 && m == 2);
+            REQUIRE(dispatch(block_kernel{}, DS(k, m), 1) == (covered ? 1 + k * 100 + m : 0));
+        }
+    }
+
+    REQUIRE(dispatch(throw_on_no_match, block_kernel{}, DS(64, 8), 0) == 6408);
+    REQUIRE_THROWS_AS(dispatch(throw_on_no_match, block_kernel{}, DS(3, 2), 0), poet::no_match_error);
+}
+
+TEST_CASE("dispatch_set range path instantiates only covered combinations", "[static_dispatch][tuples][ranges]") {
+    using Layout =
+      poet::detail::set_layout<poet::product_<inclusive_range<1, 64>, std::integer_sequence<int, 4, 8>>, tuple_<2, 2>>;
+    using Axes = Layout::axes;
+    static_assert(std::is_same_v<std::tuple_element_t<0, Axes>, inclusive_range<1, 64>>, "axis is the value union");
+    static_assert(std::is_same_v<std::tuple_element_t<1, Axes>, std::integer_sequence<int, 2, 4, 8>>,
+      "axis is sorted and de-duplicated");
+
+    using Slots = poet::detail::nd_slot_map<poet::detail::set_policy<block_kernel, Layout>, Axes>;
+    static_assert(Slots::total == 64 * 3, "slot table spans the axis product");
+    static_assert(Slots::unique_count == 64 * 2 + 1, "one thunk per covered combination");
+}
+
+TEST_CASE("dispatch_set where_ entries filter a product with a predicate", "[static_dispatch][tuples][ranges]") {
+    using DS = dispatch_set<int, poet::where_<divides, inclusive_range<1, 6>, inclusive_range<1, 12>>>;
+    for (int a = 0; a <= 7; ++a) {
+        for (int b = 0; b <= 13; ++b) {
+            const bool covered = a >= 1 && a <= 6 && b >= 1 && b <= 12 && b % a == 0;
+            REQUIRE(dispatch(tuple_sum{}, DS(a, b), 0) == (covered ? a + b : 0));
+        }
+    }
+}
+
+TEST_CASE("dispatch_set range path calls stateful functors by reference", "[static_dispatch][tuples][ranges]") {
+    using DS = dispatch_set<int, poet::product_<std::integer_sequence<int, 1, 3>, inclusive_range<0, 2>>>;
+    stateful_pair_sum sum;
+    dispatch(sum, DS(3, 2));
+    dispatch(sum, DS(1, 0));
+    dispatch(sum, DS(2, 0));
+    REQUIRE(sum.total == 32 + 10);
+}
+
 TEST_CASE("dispatch_tuples_impl matches correct tuple", "[static_dispatch][tuples][internal]") {
     using TL = std::tuple<std::integer_sequence<int, 1, 2>, std::integer_sequence<int, 3, 4>>;
     auto rt = std::make_tuple(3, 4);
@@ -1171,3 +1660,53 @@ TEST_CASE("dispatch ND lambda returns pointer (lvalue)", "[static_dispatch][retu
         }
     }
 }
+
+// ============================================================================
+// Grouped dispatch
+// ============================================================================
+
+TEST_CASE("resolve_dispatch looks up once and drives several functors", "[static_dispatch][group]") {
+    using Ms = std::integer_sequence<int, 1, 2, 4>;
+    using Ks = inclusive_range<0, 3>;
+    for (int m : { 1, 2, 4 }) {
+        for (int n : { 1, 2, 4 }) {
+            for (int k = 0; k <= 3; ++k) {
+                const auto resolved =
+                  poet::resolve_dispatch(dispatch_param<Ms>{ m }, dispatch_param<Ms>{ n }, dispatch_param<Ks>{ k });
+                REQUIRE(resolved.matched());
+                // The same index serves a plain table and a narrowed one.
+                REQUIRE(resolved(triangular_kernel{}, 7) == (m <= n ? 7 + m * 100 + n : 0));
+                REQUIRE(resolved([](auto a, auto b, auto c) { return a * 100 + b * 10 + c; })
+                        == m * 100 + n * 10 + k);
+            }
+        }
+    }
+
+    const auto miss = poet::resolve_dispatch(std::make_tuple(dispatch_param<Ms>{ 3 }, dispatch_param<Ms>{ 1 }));
+    REQUIRE_FALSE(miss.matched());
+    REQUIRE(miss([](auto a, auto b) { return a + b; }) == 0);
+    REQUIRE_THROWS_AS(miss(poet::throw_on_no_match, [](auto a, auto b) { return a + b; }), poet::no_match_error);
+
+    int calls = 0;
+    const auto single = poet::resolve_dispatch(dispatch_param<inclusive_range<0, 7>>{ 3 });
+    single(even_only_counter{ &calls }, 1);
+    REQUIRE(calls == 0);
+    poet::resolve_dispatch(dispatch_param<inclusive_range<0, 7>>{ 6 })(even_only_counter{ &calls }, 2);
+    REQUIRE(calls == 12);
+}
+
+TEST_CASE("dispatch_group runs each functor with one lookup", "[static_dispatch][group]") {
+    std::vector<int> log;
+    using Seq = inclusive_range<0, 3>;
+    auto params = std::make_tuple(dispatch_param<Seq>{ 2 }, dispatch_param<Seq>{ 1 });
+    poet::dispatch_group(
+      params,
+      [&](auto a, auto b) { log.push_back(a * 10 + b); },
+      [&](auto a, auto b) { log.push_back(a + b); },
+      [&](auto a, auto /*b*/) { return static_cast<int>(a); });
+    REQUIRE(log == std::vector<int>{ 21, 3 });
+
+    poet::dispatch_group(dispatch_param<inclusive_range<0, 3>>{ 5 }, [&](auto a) { log.push_back(a); });
+    poet::dispatch_group(dispatch_param<inclusive_range<0, 3>>{ 0 }, [&](auto a) { log.push_back(a - 1); });
+    REQUIRE(log == std::vector<int>{ 21, 3, -1 });
+}
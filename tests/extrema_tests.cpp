@@ -0,0 +1,102 @@
+#include <poet/core/extrema.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+#include <span>
+#endif
+
+namespace {
+// Small values with many repeats, so every lane sees ties.
+auto repeating_values(std::size_t n, std::uint32_t seed) -> std::vector<int> {
+    std::vector<int> out(n);
+    std::uint32_t x = seed;
+    for (auto &v : out) {
+        x = x * 1664525U + 1013904223U;
+        v = static_cast<int>((x >> 16U) % 50U) - 25;
+    }
+    return out;
+}
+
+auto first_max(const std::vector<int> &v) -> std::size_t {
+    return static_cast<std::size_t>(std::distance(v.begin(), std::max_element(v.begin(), v.end())));
+}
+
+auto first_min(const std::vector<int> &v) -> std::size_t {
+    return static_cast<std::size_t>(std::distance(v.begin(), std::min_element(v.begin(), v.end())));
+}
+}// namespace
+
+TEST_CASE("argmax and argmin pick the first extreme element", "[extrema]") {
+    for (std::size_t n = 1; n <= 70; ++n) {
+        const auto v = repeating_values(n, static_cast<std::uint32_t>(n));
+        REQUIRE(poet::argmax(v.data(), n) == first_max(v));
+        REQUIRE(poet::argmin(v.data(), n) == first_min(v));
+        REQUIRE(poet::argmax<1>(v.data(), n) == first_max(v));
+        REQUIRE(poet::argmin<7>(v.data(), n) == first_min(v));
+    }
+
+    // Ties spread across lanes still resolve to the lowest index.
+    const std::vector<double> flat{ 1.0, 3.0, 2.0, 3.0, 3.0, -1.0, 3.0, -1.0, 0.0 };
+    REQUIRE(poet::argmax<4>(flat.data(), flat.size()) == 1);
+    REQUIRE(poet::argmin<4>(flat.data(), flat.size()) == 5);
+    REQUIRE(poet::argmax<8>(flat.data() + 2, flat.size() - 2) == 1);
+
+    REQUIRE(poet::argmax(flat.data(), 0) == 0);
+}
+
+TEST_CASE("minmax reports both extremes in one pass", "[extrema]") {
+    const auto v = repeating_values(53, 9);
+    const auto r = poet::minmax<4>(v.data(), v.size());
+    REQUIRE(r.min.index == first_min(v));
+    REQUIRE(r.max.index == first_max(v));
+    REQUIRE(r.min.value == v[r.min.index]);
+    REQUIRE(r.max.value == v[r.max.index]);
+
+    const std::vector<float> single{ 2.5F };
+    const auto one = poet::minmax(single.data(), single.size());
+    REQUIRE(one.min.index == 0);
+    REQUIRE(one.max.value == 2.5F);
+
+    const auto none = poet::minmax(single.data(), 0);
+    REQUIRE(none.min.index == 0);
+    REQUIRE(none.max.value == 0.0F);
+}
+
+TEST_CASE("extrema keep the lowest index when split across threads", "[extrema]") {
+    // Enough elements that four threads each get a chunk.
+    const std::size_t n = 4 * poet::detail::min_parallel_chunk + 123;
+    auto v = repeating_values(n, 77);
+    // Plant the extremes in the last chunk first, then repeat them in earlier chunks.
+    v[n - 5] = 1000;
+    v[n - 7] = -1000;
+    REQUIRE(poet::argmax(v.data(), n, 4) == n - 5);
+    REQUIRE(poet::argmin(v.data(), n, 4) == n - 7);
+    v[n / 2] = 1000;
+    v[3 * n / 4] = -1000;
+    v[n / 3] = -1000;
+    const auto r = poet::minmax<8>(v.data(), n, 4);
+    REQUIRE(r.max.index == n / 2);
+    REQUIRE(r.min.index == n / 3);
+    REQUIRE(r.min.index == first_min(v));
+    REQUIRE(poet::argmax<2>(v.data(), n, 3) == first_max(v));
+
+    // Too few elements per thread: runs serially with the same answer.
+    REQUIRE(poet::argmax(v.data(), 1000, 8) == first_max(std::vector<int>(v.begin(), v.begin() + 1000)));
+}
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+TEST_CASE("extrema accept spans", "[extrema]") {
+    const auto v = repeating_values(31, 4);
+    const std::span<const int> s(v);
+    REQUIRE(poet::argmax(s) == first_max(v));
+    REQUIRE(poet::argmin<2>(s) == first_min(v));
+    REQUIRE(poet::minmax(s).max.index == first_max(v));
+}
+#endif
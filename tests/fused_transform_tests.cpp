@@ -0,0 +1,85 @@
+#include <poet/core/fused_transform.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace {
+struct int_ops {
+    static constexpr int op_count = 4;
+    template<int Op, typename T> static constexpr auto apply(T x) -> T {
+        if constexpr (Op == 0) {
+            return x + 1;
+        } else if constexpr (Op == 1) {
+            return x * 2;
+        } else if constexpr (Op == 2) {
+            return x - 3;
+        } else {
+            return -x;
+        }
+    }
+};
+
+auto reference(const std::vector<int> &codes, int x) -> int {
+    for (const int code : codes) {
+        switch (code) {
+        case 0: x += 1; break;
+        case 1: x *= 2; break;
+        case 2: x -= 3; break;
+        default: x = -x; break;
+        }
+    }
+    return x;
+}
+
+auto iota_input(std::size_t n) -> std::vector<int> {
+    std::vector<int> in(n);
+    for (std::size_t i = 0; i < n; ++i) { in[i] = static_cast<int>(i) - 5; }
+    return in;
+}
+}// namespace
+
+TEST_CASE("fused_transform applies op chains of every length up to the table rank", "[fused_transform]") {
+    const auto in = iota_input(19);
+    const std::vector<std::vector<int>> chains = {
+        {}, { 3 }, { 0, 1 }, { 1, 0 }, { 2, 2, 2 }, { 1, 3, 0 }, { 0, 1, 2, 3 }, { 3, 1, 1, 0, 2, 1, 3 }
+    };
+    for (const auto &chain : chains) {
+        std::vector<int> out(in.size(), 0);
+        REQUIRE(poet::fused_transform<int_ops>(chain.data(), chain.size(), in.data(), out.data(), in.size()));
+        for (std::size_t i = 0; i < in.size(); ++i) { REQUIRE(out[i] == reference(chain, in[i])); }
+    }
+}
+
+TEST_CASE("fused_transform works in place and with other ranks", "[fused_transform]") {
+    auto data = iota_input(10);
+    const auto expected = data;
+    const std::vector<int> chain = { 1, 0, 1, 2, 3 };
+    REQUIRE(poet::fused_transform<int_ops, 2, 3>(chain.data(), chain.size(), data.data(), data.data(), data.size()));
+    for (std::size_t i = 0; i < data.size(); ++i) { REQUIRE(data[i] == reference(chain, expected[i])); }
+
+    std::vector<double> values = { 1.5, -2.0, 4.0 };
+    const std::vector<int> single = { 1, 1 };
+    REQUIRE(poet::fused_transform<int_ops, 1>(single.data(), single.size(), values.data(), values.data(), 3));
+    REQUIRE(values == std::vector<double>{ 6.0, -8.0, 16.0 });
+}
+
+TEST_CASE("fused_transform rejects unknown op codes before writing", "[fused_transform]") {
+    const auto in = iota_input(4);
+    std::vector<int> out(4, 7);
+    const std::vector<int> bad = { 0, 4 };
+    REQUIRE_FALSE(poet::fused_transform<int_ops>(bad.data(), bad.size(), in.data(), out.data(), in.size()));
+    const std::vector<int> negative = { -1 };
+    REQUIRE_FALSE(poet::fused_transform<int_ops>(negative.data(), negative.size(), in.data(), out.data(), in.size()));
+    REQUIRE(out == std::vector<int>(4, 7));
+}
+
+TEST_CASE("fused_transform instantiates padding only at the tail", "[fused_transform]") {
+    using pass = poet::detail::fused_pass<int_ops, 4, int>;
+    STATIC_REQUIRE(pass::dispatch_valid(0, 1, 2));
+    STATIC_REQUIRE(pass::dispatch_valid(0, 4, 4));
+    STATIC_REQUIRE(pass::dispatch_valid(4, 4, 4));
+    STATIC_REQUIRE_FALSE(pass::dispatch_valid(4, 1, 4));
+    STATIC_REQUIRE_FALSE(pass::dispatch_valid(0, 4, 2));
+}
@@ -0,0 +1,88 @@
+#include <poet/core/poly_vector.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace {
+struct circle {
+    double r;
+    [[nodiscard]] auto area() const -> double { return 3.0 * r * r; }
+};
+
+struct square {
+    double side;
+    [[nodiscard]] auto area() const -> double { return side * side; }
+};
+
+struct label {
+    explicit label(std::string t) : text(std::move(t)) {}
+
+    std::string text;
+    [[nodiscard]] auto area() const -> double { return static_cast<double>(text.size()); }
+};
+
+using shapes = poet::poly_vector<circle, square, label>;
+}// namespace
+
+TEST_CASE("poly_vector stores each type in its own segment", "[poly_vector]") {
+    shapes v;
+    REQUIRE(v.empty());
+    v.push_back(circle{ 1.0 });
+    v.push_back(square{ 2.0 });
+    v.emplace_back<label>("abc");
+    v.push_back(circle{ 2.0 });
+    const square s{ 3.0 };
+    v.push_back(s);
+
+    REQUIRE(v.size() == 5);
+    REQUIRE(v.segment<circle>().size() == 2);
+    REQUIRE(v.segment<square>().size() == 2);
+    REQUIRE(v.segment<label>().front().text == "abc");
+    REQUIRE(v.segment<circle>()[1].r == 2.0);
+
+    v.clear();
+    REQUIRE(v.empty());
+    REQUIRE(v.segment<circle>().empty());
+}
+
+TEST_CASE("poly_vector::for_each visits every element with its static type", "[poly_vector]") {
+    shapes v;
+    for (int i = 0; i < 11; ++i) { v.push_back(circle{ static_cast<double>(i) }); }
+    for (int i = 0; i < 6; ++i) { v.push_back(square{ static_cast<double>(i) }); }
+    v.push_back(label{ "four" });
+
+    double total = 0.0;
+    std::vector<int> order;
+    v.for_each<4>([&](const auto &shape) {
+        total += shape.area();
+        using T = std::decay_t<decltype(shape)>;
+        order.push_back(std::is_same_v<T, circle> ? 0 : std::is_same_v<T, square> ? 1 : 2);
+    });
+    double expected = 4.0;
+    for (int i = 0; i < 11; ++i) { expected += 3.0 * i * i; }
+    for (int i = 0; i < 6; ++i) { expected += static_cast<double>(i * i); }
+    REQUIRE(total == expected);
+    REQUIRE(order.size() == 18);
+    REQUIRE(order.front() == 0);
+    REQUIRE(order[11] == 1);
+    REQUIRE(order.back() == 2);
+
+    // Mutating pass, then the lane form on a const container.
+    v.for_each<2>([](auto &shape) {
+        if constexpr (std::is_same_v<std::decay_t<decltype(shape)>, square>) { shape.side *= 2; }
+    });
+    const shapes &cv = v;
+    std::vector<std::size_t> lanes;
+    cv.for_each<3>([&](auto lane, const auto &shape) {
+        if constexpr (std::is_same_v<std::decay_t<decltype(shape)>, square>) {
+            lanes.push_back(decltype(lane)::value);
+            REQUIRE(static_cast<int>(shape.side) % 2 == 0);
+        }
+    });
+    REQUIRE(lanes == std::vector<std::size_t>{ 0, 1, 2, 0, 1, 2 });
+}
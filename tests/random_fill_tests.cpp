@@ -0,0 +1,108 @@
+#include <poet/core/random_fill.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+#include <span>
+#endif
+
+using poet::philox_block;
+using poet::philox4x32;
+
+TEST_CASE("philox4x32 matches the Random123 known-answer vectors", "[random_fill]") {
+    REQUIRE(philox4x32(0)(philox_block{ 0, 0, 0, 0 })
+            == philox_block{ 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 });
+    REQUIRE(philox4x32(~std::uint64_t{ 0 })(philox_block{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff })
+            == philox_block{ 0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd });
+    REQUIRE(philox4x32(0x299f31d0a4093822ULL)(philox_block{ 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 })
+            == philox_block{ 0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 });
+
+    // The generator is usable in constant expressions.
+    static_assert(philox4x32(0)(0)[0] == 0x6627e8d5U);
+    REQUIRE(philox4x32(7)(5, 1) != philox4x32(7)(5, 0));
+
+    // Batched blocks equal one call per counter, across the 2^32 carry too.
+    const philox4x32 gen(99);
+    const std::uint64_t first = 0xfffffffeULL;
+    const auto batch = gen.blocks<5>(first, 3);
+    for (std::size_t l = 0; l < batch.size(); ++l) { REQUIRE(batch[l] == gen(first + l, 3)); }
+}
+
+TEST_CASE("random_fill output does not depend on unroll or threads", "[random_fill]") {
+    const std::size_t n = 4 * poet::detail::min_parallel_chunk + 17;
+    const poet::uniform_real<double> unit{};
+    std::vector<double> reference(n);
+    poet::random_fill<1>(reference.data(), n, 42, unit);
+    REQUIRE(reference[3] == unit(philox4x32(42)(3)));
+
+    std::vector<double> other(n);
+    poet::random_fill<8>(other.data(), n, 42, unit);
+    REQUIRE(other == reference);
+    poet::random_fill<4>(other.data(), n, 42, unit, 4);
+    REQUIRE(other == reference);
+    poet::random_fill<3>(other.data(), n, 42, unit, 3);
+    REQUIRE(other == reference);
+
+    poet::random_fill(other.data(), n, 43, unit);
+    REQUIRE(other != reference);
+}
+
+TEST_CASE("random_fill distributions stay in range", "[random_fill]") {
+    constexpr std::size_t n = 20000;
+    std::vector<float> reals(n);
+    poet::random_fill(reals.data(), n, 1, poet::uniform_real<float>{ -2.0F, 3.0F });
+    double mean = 0.0;
+    for (float v : reals) {
+        REQUIRE(v >= -2.0F);
+        REQUIRE(v <= 3.0F);
+        mean += static_cast<double>(v);
+    }
+    REQUIRE(std::abs(mean / n - 0.5) < 0.05);
+
+    std::vector<int> dice(n);
+    poet::random_fill(dice.data(), n, 2, poet::uniform_int<int>{ -3, 2 });
+    std::vector<int> hits(6);
+    for (int v : dice) {
+        REQUIRE(v >= -3);
+        REQUIRE(v <= 2);
+        ++hits[static_cast<std::size_t>(v + 3)];
+    }
+    for (int h : hits) { REQUIRE(std::abs(h - static_cast<int>(n / 6)) < 300); }
+
+    // The full 64-bit range uses the raw bits.
+    std::vector<std::int64_t> wide(64);
+    poet::random_fill(wide.data(), wide.size(), 3, poet::uniform_int<std::int64_t>{
+      std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::max() });
+    bool negative = false;
+    for (auto v : wide) { negative = negative || v < 0; }
+    REQUIRE(negative);
+
+    std::vector<double> gauss(n);
+    poet::random_fill<8>(gauss.data(), n, 4, poet::normal<double>{ 10.0, 2.0 });
+    double sum = 0.0;
+    double sum_sq = 0.0;
+    for (double v : gauss) {
+        REQUIRE(std::isfinite(v));
+        sum += v;
+        sum_sq += v * v;
+    }
+    const double m = sum / n;
+    REQUIRE(std::abs(m - 10.0) < 0.1);
+    REQUIRE(std::abs(std::sqrt(sum_sq / n - m * m) - 2.0) < 0.1);
+}
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+TEST_CASE("random_fill accepts a span", "[random_fill]") {
+    std::vector<std::uint32_t> a(100);
+    std::vector<std::uint32_t> b(100);
+    poet::random_fill(std::span(a), 9, poet::uniform_int<std::uint32_t>{});
+    poet::random_fill<2>(b.data(), b.size(), 9, poet::uniform_int<std::uint32_t>{});
+    REQUIRE(a == b);
+}
+#endif
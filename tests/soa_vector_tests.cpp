@@ -0,0 +1,132 @@
+#include <poet/core/soa_vector.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace {
+struct particle {
+    float x;
+    float v;
+    int id;
+    double mass;
+};
+
+using particles = poet::soa_vector<float, float, int, double>;
+
+auto make_particles(std::size_t n) -> std::vector<particle> {
+    std::vector<particle> out;
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto f = static_cast<float>(i);
+        out.push_back({ f, 0.5F * f, static_cast<int>(i) * 10, 2.0 * static_cast<double>(i) });
+    }
+    return out;
+}
+}// namespace
+
+TEST_CASE("soa_vector keeps fields in parallel aligned columns", "[soa_vector]") {
+    particles p;
+    REQUIRE(p.empty());
+    p.push_back(1.0F, 2.0F, 3, 4.0);
+    p.push_back(5.0F, 6.0F, 7, 8.0);
+    REQUIRE(p.size() == 2);
+    REQUIRE(p.field<2>().size() == 2);
+    REQUIRE(p.field<1>()[1] == 6.0F);
+
+    auto [x, v, id, mass] = p[0];
+    REQUIRE(id == 3);
+    x += v;
+    REQUIRE(p.field<0>()[0] == 3.0F);
+    REQUIRE(std::get<3>(std::as_const(p)[1]) == 8.0);
+    static_cast<void>(mass);
+
+    p.resize(40);
+    REQUIRE(p.field<3>().size() == 40);
+    REQUIRE(p.field<3>()[39] == 0.0);
+    const auto alignment = poet::constructive_interference_size();
+    REQUIRE(reinterpret_cast<std::uintptr_t>(p.field<0>().data()) % alignment == 0);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(p.field<3>().data()) % alignment == 0);
+
+    p.clear();
+    REQUIRE(p.empty());
+    REQUIRE(p.field<1>().empty());
+}
+
+TEST_CASE("soa_vector::for_each visits the selected fields", "[soa_vector]") {
+    particles p;
+    const auto aos = make_particles(13);
+    p.append_aos<&particle::x, &particle::v, &particle::id, &particle::mass>(aos.data(), aos.size());
+
+    // Only x and v are touched: the reference tuple carries just those two.
+    p.for_each<4, 0, 1>([](auto refs) {
+        static_assert(std::tuple_size_v<decltype(refs)> == 2);
+        auto [x, v] = refs;
+        x += v;
+    });
+    for (std::size_t i = 0; i < aos.size(); ++i) { REQUIRE(p.field<0>()[i] == aos[i].x + aos[i].v); }
+
+    // The lane form accumulates into per-lane partial sums.
+    double partial[4] = {};
+    std::as_const(p).for_each<4, 3>([&](auto lane, auto refs) { partial[lane] += std::get<0>(refs); });
+    double expected = 0.0;
+    for (const auto &q : aos) { expected += q.mass; }
+    REQUIRE(partial[0] + partial[1] + partial[2] + partial[3] == expected);
+
+    int id_sum = 0;
+    std::as_const(p).for_each<3>([&](const auto &refs) {
+        static_assert(std::is_same_v<std::decay_t<decltype(refs)>, particles::const_reference>);
+        id_sum += std::get<2>(refs);
+    });
+    REQUIRE(id_sum == 780);
+}
+
+TEST_CASE("soa_vector converts to and from arrays of structs", "[soa_vector]") {
+    const auto aos = make_particles(21);
+    particles p;
+    p.push_back(-1.0F, -2.0F, -3, -4.0);
+    p.append_aos<&particle::x, &particle::v, &particle::id, &particle::mass>(aos.data(), aos.size());
+    REQUIRE(p.size() == 22);
+    REQUIRE(p.field<2>()[0] == -3);
+    REQUIRE(p.field<2>()[21] == 200);
+
+    std::vector<particle> back(p.size());
+    p.copy_to_aos<&particle::x, &particle::v, &particle::id, &particle::mass>(back.data());
+    REQUIRE(back[0].mass == -4.0);
+    for (std::size_t i = 0; i < aos.size(); ++i) {
+        REQUIRE(back[i + 1].x == aos[i].x);
+        REQUIRE(back[i + 1].v == aos[i].v);
+        REQUIRE(back[i + 1].id == aos[i].id);
+        REQUIRE(back[i + 1].mass == aos[i].mass);
+    }
+
+    // Members can be listed in any order; field I always maps to the I-th pointer.
+    poet::soa_vector<int, double> ids_and_mass;
+    ids_and_mass.append_aos<&particle::id, &particle::mass>(aos.data(), aos.size());
+    REQUIRE(ids_and_mass.field<0>()[5] == 50);
+    REQUIRE(ids_and_mass.field<1>()[5] == 10.0);
+}
+
+TEST_CASE("soa_vector grows geometrically under small appends", "[soa_vector]") {
+    const auto aos = make_particles(3);
+    particles p;
+    std::size_t reallocations = 0;
+    std::size_t capacity = p.capacity();
+    for (std::size_t batch = 0; batch < 1000; ++batch) {
+        p.append_aos<&particle::x, &particle::v, &particle::id, &particle::mass>(aos.data(), 1 + batch % 3);
+        if (p.capacity() != capacity) {
+            if (capacity != 0) { REQUIRE(p.capacity() >= 2 * capacity); }
+            capacity = p.capacity();
+            ++reallocations;
+        }
+    }
+    REQUIRE(p.size() == 1999);
+    REQUIRE(p.field<2>()[p.size() - 1] == 0);
+    REQUIRE(reallocations <= 12);
+
+    p.resize(p.size() + 1);
+    REQUIRE(p.capacity() >= p.size());
+}
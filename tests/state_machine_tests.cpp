@@ -0,0 +1,98 @@
+#include <poet/core/state_machine.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+// A tiny stack bytecode: each handler executes one op and returns the next opcode.
+enum op : int { op_push = 0, op_add = 1, op_mul = 2, op_jnz = 3, op_dec = 4, op_halt = 5 };
+
+struct vm {
+    explicit vm(std::vector<int> program) : code(std::move(program)) {}
+
+    std::vector<int> code;
+    std::size_t pc = 0;
+    std::vector<int> stack;
+    std::size_t steps = 0;
+
+    auto fetch() -> int { return code[pc++]; }
+};
+
+struct vm_handler {
+    template<int Op> auto operator()(vm &m) const -> int {
+        ++m.steps;
+        if constexpr (Op == op_push) {
+            m.stack.push_back(m.fetch());
+        } else if constexpr (Op == op_add || Op == op_mul) {
+            const int rhs = m.stack.back();
+            m.stack.pop_back();
+            m.stack.back() = Op == op_add ? m.stack.back() + rhs : m.stack.back() * rhs;
+        } else if constexpr (Op == op_dec) {
+            --m.stack.back();
+        } else if constexpr (Op == op_jnz) {
+            const int target = m.fetch();
+            if (m.stack.back() != 0) { m.pc = static_cast<std::size_t>(target); }
+        } else {
+            return -1;// halt
+        }
+        return m.fetch();
+    }
+};
+
+// Sparse states, value-form handler, stateful handler: counts 'a'..'c' runs in a string.
+struct scanner {
+    std::string input;
+    std::size_t pos = 0;
+};
+
+struct run_counter {
+    int runs = 0;
+
+    template<int State> auto operator()(std::integral_constant<int, State> /*state*/, scanner &s) -> int {
+        if (s.pos == s.input.size()) { return State == 100 ? 0 : 1; }
+        const char c = s.input[s.pos++];
+        const int next = c == 'a' ? 100 : 700;
+        if (next == 100 && State != 100) { ++runs; }
+        return next;
+    }
+};
+}// namespace
+
+TEST_CASE("state_machine interprets bytecode through per-op handlers", "[state_machine]") {
+    // (2 + 3) * 4
+    vm m({ op_push, 2, op_push, 3, op_add, op_push, 4, op_mul, op_halt });
+    const int exit_code = poet::state_machine<op_push, op_add, op_mul, op_jnz, op_dec, op_halt>::run(
+      vm_handler{}, m.fetch(), m);
+    REQUIRE(exit_code == -1);
+    REQUIRE(m.stack == std::vector<int>{ 20 });
+    REQUIRE(m.steps == 6);
+}
+
+TEST_CASE("state_machine runs long loops without growing the stack", "[state_machine]") {
+    // counter = 300000; loop: dec; jnz loop
+    vm m({ op_push, 300000, op_dec, op_jnz, 2, op_halt });
+    using machine = poet::state_machine<op_push, op_add, op_mul, op_jnz, op_dec, op_halt>;
+    REQUIRE(machine::run(vm_handler{}, m.fetch(), m) == -1);
+    REQUIRE(m.stack == std::vector<int>{ 0 });
+    REQUIRE(m.steps == 1 + 2 * 300000 + 1);
+}
+
+TEST_CASE("state_machine supports sparse states, value-form handlers and exit codes", "[state_machine]") {
+    using machine = poet::state_machine<7, 100, 700>;
+    run_counter counter;
+    scanner s{ "aabxaacaa" };
+    REQUIRE(machine::run(counter, 7, s) == 0);
+    REQUIRE(counter.runs == 3);
+
+    scanner tail{ "ab" };
+    REQUIRE(machine::run(counter, 7, tail) == 1);
+
+    // A start value outside the states halts immediately.
+    scanner unused{ "aaa" };
+    REQUIRE(machine::run(counter, 8, unused) == 8);
+    REQUIRE(unused.pos == 0);
+}